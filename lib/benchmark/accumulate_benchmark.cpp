@@ -5,6 +5,7 @@
 #include <benchmark/benchmark.h>
 
 #include "scipp/variable/accumulate.h"
+#include "scipp/variable/cumulative.h"
 #include "scipp/variable/variable.h"
 
 using namespace scipp;
@@ -53,4 +54,27 @@ BENCHMARK(BM_accumulate_in_place)
     ->RangeMultiplier(2)
     ->Ranges({{2, 2ul << 25ul}, {false, true}, {false, true}});
 
+static void BM_cumsum(benchmark::State &state) {
+  const auto n = 2ul << 26ul;
+  const auto nx = state.range(0);
+  const auto ny = n / nx;
+  const bool outer = state.range(1);
+  const auto var = makeVariable<double>(Dimensions{{Dim::X, nx}, {Dim::Y, ny}});
+
+  for ([[maybe_unused]] auto _ : state) {
+    auto result = cumsum(var, outer ? Dim::X : Dim::Y);
+    benchmark::DoNotOptimize(result);
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+  state.SetBytesProcessed(state.iterations() * n * 2 * sizeof(double));
+  state.counters["n_outer"] = nx;
+  state.counters["n_inner"] = ny;
+  state.counters["cumsum-outer"] = outer;
+}
+
+BENCHMARK(BM_cumsum)
+    ->RangeMultiplier(16)
+    ->Ranges({{1, 2ul << 25ul}, {false, true}});
+
 BENCHMARK_MAIN();
@@ -0,0 +1,74 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+/// Benchmarks reporting heap allocations. These are separate from
+/// bin_benchmark since counting requires replacing the global operator new,
+/// which affects the timings of all benchmarks in the executable.
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include <benchmark/benchmark.h>
+
+#include "scipp/dataset/bin.h"
+#include "scipp/variable/cumulative.h"
+#include "scipp/variable/operations.h"
+
+#include "../test/random.h"
+
+using namespace scipp;
+
+namespace {
+std::atomic<int64_t> allocations{0};
+}
+
+void *operator new(std::size_t size) {
+  ++allocations;
+  if (void *ptr = std::malloc(size))
+    return ptr;
+  throw std::bad_alloc();
+}
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+void operator delete(void *ptr, std::size_t) noexcept { std::free(ptr); }
+
+auto make_table(const scipp::index size) {
+  Dimensions dims(Dim::Event, size);
+  Variable data = makeVariable<double>(Dims{Dim::Event}, Shape{size});
+  Variable x = makeRandom(dims, -2.0, 2.0);
+  Variable y = makeRandom(dims, -2.0, 2.0);
+  return DataArray(data, {{Dim::X, x}, {Dim::Y, y}});
+}
+
+auto make_edges(const Dim dim, const scipp::index size) {
+  return cumsum(broadcast((4.0 / size) * units::one, Dimensions(dim, size + 1)),
+                CumSumMode::Exclusive) -
+         (2.0 * units::one);
+}
+
+static void BM_rebin_outer_allocations(benchmark::State &state) {
+  const scipp::index nx = state.range(0);
+  const scipp::index nEvent = state.range(1);
+  auto table = make_table(nEvent);
+  auto edges_x = make_edges(Dim::X, nx);
+  auto edges_y = make_edges(Dim::Y, 4);
+
+  auto binned = dataset::bin(table, {make_edges(Dim::X, 1e4), edges_y});
+
+  const int64_t allocations_before = allocations;
+  for (auto _ : state) {
+    auto a = dataset::bin(binned, {edges_x, edges_y});
+  }
+  state.SetItemsProcessed(state.iterations() * nEvent);
+  state.counters["allocations"] =
+      benchmark::Counter(static_cast<double>(allocations - allocations_before),
+                         benchmark::Counter::kAvgIterations);
+  state.counters["xbins"] = nx;
+  state.counters["ybins"] = edges_y.dims().volume() - 1;
+  state.counters["events"] = nEvent;
+}
+BENCHMARK(BM_rebin_outer_allocations)
+    ->RangeMultiplier(100)
+    ->Ranges({{10, static_cast<int64_t>(1e6)},
+              {static_cast<int64_t>(1e6), static_cast<int64_t>(1e6)}});
+
+BENCHMARK_MAIN();
@@ -43,6 +43,11 @@ static void BM_bin_table(benchmark::State &state) {
 BENCHMARK(BM_bin_table)
     ->RangeMultiplier(10)
     ->Ranges({{10, 2ul << 19ul}, {2ul << 16ul, 2ul << 15ul}});
+// Flat tables of the size of raw event data loaded from file.
+BENCHMARK(BM_bin_table)
+    ->ArgsProduct({{10, 1000, 1000000}, {100000000}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
 
 static void BM_rebin_outer(benchmark::State &state) {
   const scipp::index nx = state.range(0);
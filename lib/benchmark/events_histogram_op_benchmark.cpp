@@ -8,6 +8,7 @@
 #include "random.h"
 
 #include "scipp/dataset/dataset.h"
+#include "scipp/dataset/histogram.h"
 #include "scipp/variable/operations.h"
 
 using namespace scipp;
@@ -120,4 +121,51 @@ BENCHMARK(BM_events_histogram_op)
     ->Ranges({{64, 2 << 14}, {128, 2 << 11}, {true, false}, {true, false}});
 */
 
+// Histogram a single long event list, i.e., a case that cannot be
+// parallelized over output histograms.
+static void BM_histogram_single_event_list(benchmark::State &state) {
+  const scipp::index nEvent = state.range(0);
+  const scipp::index nBin = state.range(1);
+  const bool linear = state.range(2);
+  const bool variances = state.range(3);
+  Random rand(0.0, 1000.0);
+  auto weights =
+      variances ? makeVariable<double>(Dims{Dim::Event}, Shape{nEvent},
+                                       Values(rand(nEvent)),
+                                       Variances(rand(nEvent)))
+                : makeVariable<double>(Dims{Dim::Event}, Shape{nEvent},
+                                       Values(rand(nEvent)));
+  const DataArray events(
+      weights, {{Dim::X, makeVariable<double>(Dims{Dim::Event}, Shape{nEvent},
+                                              Values(rand(nEvent)))}});
+  std::vector<double> edges_(nBin + 1);
+  std::iota(edges_.begin(), edges_.end(), 0.0);
+  if (!linear)
+    edges_.back() += 0.0001;
+  auto edges = makeVariable<double>(Dims{Dim::X}, Shape{nBin + 1},
+                                    Values(edges_.begin(), edges_.end()));
+  edges *= 1000.0 / nBin * units::one; // ensure all events are in range
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(dataset::histogram(events, edges));
+  }
+  state.SetItemsProcessed(state.iterations() * nEvent);
+  state.SetBytesProcessed(state.iterations() * (variances ? 3 : 2) * nEvent *
+                          sizeof(double));
+  state.counters["bins"] = nBin;
+  state.counters["const-width-bins"] = linear;
+  state.counters["variances"] = variances;
+}
+
+// Params are:
+// - nEvent
+// - nBin
+// - constant-width-bins
+// - variances
+BENCHMARK(BM_histogram_single_event_list)
+    ->ArgsProduct({{1 << 16, 1 << 20, 1 << 24, 1 << 26},
+                   {1, 1000, 1000000},
+                   {false, true},
+                   {false, true}})
+    ->Unit(benchmark::kMillisecond);
+
 BENCHMARK_MAIN();
@@ -1,7 +1,9 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
 /// @file
+#include <algorithm>
 #include <numeric>
+#include <random>
 
 #include <benchmark/benchmark.h>
 
@@ -85,6 +87,9 @@ static void BM_groupby_large_table(benchmark::State &state) {
   const scipp::index nGroup = state.range(0);
   std::vector<int64_t> group_(nRow);
   std::iota(group_.begin(), group_.end(), 0);
+  const bool shuffled = state.range(1);
+  if (shuffled)
+    std::shuffle(group_.begin(), group_.end(), std::mt19937(1234));
   Dataset d;
   const auto column = makeVariable<double>(Dims{Dim::X}, Shape{nRow});
   d.setData("a", column);
@@ -106,8 +111,12 @@ static void BM_groupby_large_table(benchmark::State &state) {
   state.SetBytesProcessed(state.iterations() * (nCol + 1) * (nRow + nGroup) *
                           sizeof(double));
   state.counters["groups"] = nGroup;
+  state.counters["shuffled"] = shuffled;
 }
 
-BENCHMARK(BM_groupby_large_table)->RangeMultiplier(2)->Range(64, 2 << 20);
+// Second arg: shuffled keys, i.e., every group consists of many slices.
+BENCHMARK(BM_groupby_large_table)
+    ->RangeMultiplier(2)
+    ->Ranges({{64, 2 << 20}, {0, 1}});
 
 BENCHMARK_MAIN();
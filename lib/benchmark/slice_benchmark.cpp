@@ -4,6 +4,7 @@
 #include <benchmark/benchmark.h>
 
 #include "scipp/dataset/dataset.h"
+#include "scipp/dataset/slice.h"
 
 using namespace scipp;
 
@@ -63,10 +64,44 @@ static void BM_dataset_slice_aggregate(benchmark::State &state) {
   state.SetItemsProcessed(state.iterations());
 }
 
+// Data array similar to a detector with many spectra, with coords and masks
+// depending on the spectrum and a bin-edge coord along the inner dim.
+auto make_spectra(const scipp::index nSpectrum) {
+  const scipp::index nBin = 100;
+  const auto spectrum = makeVariable<double>(Dims{Dim::X}, Shape{nSpectrum});
+  return DataArray(
+      makeVariable<double>(Dims{Dim::X, Dim::Y}, Shape{nSpectrum, nBin}),
+      {{Dim::X, spectrum},
+       {Dim::Y, makeVariable<double>(Dims{Dim::Y}, Shape{nBin + 1})},
+       {Dim::Position, spectrum}},
+      {{"mask", makeVariable<bool>(Dims{Dim::X}, Shape{nSpectrum})}});
+}
+
+static void BM_data_array_slice_sequential(benchmark::State &state) {
+  const auto nSpectrum = state.range(0);
+  const auto da = make_spectra(nSpectrum);
+  for (auto _ : state) {
+    for (scipp::index i = 0; i < nSpectrum; ++i)
+      benchmark::DoNotOptimize(da.slice({Dim::X, i}));
+  }
+  state.SetItemsProcessed(state.iterations() * nSpectrum);
+}
+
+static void BM_data_array_slices_batched(benchmark::State &state) {
+  const auto nSpectrum = state.range(0);
+  const auto da = make_spectra(nSpectrum);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(slices(da, Dim::X));
+  }
+  state.SetItemsProcessed(state.iterations() * nSpectrum);
+}
+
 BENCHMARK(BM_dataset_create_view);
 BENCHMARK(BM_dataset_slice);
 BENCHMARK(BM_dataset_slice_item);
 BENCHMARK(BM_dataset_slice_item_dims);
 BENCHMARK(BM_dataset_slice_aggregate);
+BENCHMARK(BM_data_array_slice_sequential)->Arg(100000);
+BENCHMARK(BM_data_array_slices_batched)->Arg(100000);
 
 BENCHMARK_MAIN();
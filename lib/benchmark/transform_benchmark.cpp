@@ -6,8 +6,12 @@
 
 #include <random>
 
+#include "scipp/variable/arithmetic.h"
 #include "scipp/variable/bins.h"
+#include "scipp/variable/lazy_arithmetic.h"
+#include "scipp/variable/math.h"
 #include "scipp/variable/transform.h"
+#include "scipp/variable/trigonometry.h"
 #include "scipp/variable/variable.h"
 
 using namespace scipp;
@@ -198,6 +202,134 @@ BENCHMARK(BM_transform_slice)
     ->RangeMultiplier(2)
     ->Ranges({{1, 2 << 18}, {false, true}});
 
+// Large contiguous operands of built-in operations, processed by the
+// vectorizable inner loop of transform.
+template <class T, class Func>
+void run_contiguous(benchmark::State &state, Func func,
+                    const scipp::index n_operand,
+                    const units::Unit unit = units::one) {
+  const auto n = state.range(0);
+  const auto a = makeVariable<T>(Dims{Dim::X}, Shape{n}, unit);
+  const auto b = copy(a);
+  func(state, a, b);
+  state.SetItemsProcessed(state.iterations() * n);
+  state.SetBytesProcessed(state.iterations() * n * n_operand * sizeof(T));
+  state.counters["n"] = n;
+  state.counters["size"] = benchmark::Counter(
+      static_cast<double>(n * n_operand * sizeof(T)),
+      benchmark::Counter::kDefaults, benchmark::Counter::OneK::kIs1024);
+}
+
+template <class T>
+static void BM_transform_contiguous_add(benchmark::State &state) {
+  run_contiguous<T>(
+      state,
+      [](auto &state_, const auto &a, const auto &b) {
+        for ([[maybe_unused]] auto _ : state_) {
+          auto out = a + b;
+          state_.PauseTiming();
+          out = Variable();
+          state_.ResumeTiming();
+        }
+      },
+      3);
+}
+
+template <class T>
+static void BM_transform_contiguous_add_in_place(benchmark::State &state) {
+  run_contiguous<T>(
+      state,
+      [](auto &state_, const auto &a, const auto &b) {
+        auto out = copy(a);
+        for ([[maybe_unused]] auto _ : state_) {
+          out += b;
+        }
+      },
+      3);
+}
+
+template <class T>
+static void BM_transform_contiguous_sqrt(benchmark::State &state) {
+  run_contiguous<T>(
+      state,
+      [](auto &state_, const auto &a, const auto &) {
+        auto out = copy(a);
+        for ([[maybe_unused]] auto _ : state_) {
+          sqrt(a, out);
+        }
+      },
+      2);
+}
+
+template <class T>
+static void BM_transform_contiguous_sin(benchmark::State &state) {
+  run_contiguous<T>(
+      state,
+      [](auto &state_, const auto &a, const auto &) {
+        auto out = copy(a);
+        out.setUnit(units::one);
+        for ([[maybe_unused]] auto _ : state_) {
+          sin(a, out);
+        }
+      },
+      2, units::rad);
+}
+
+// Chained arithmetic with a temporary per operator, or fused with lazy::expr.
+template <class T, bool lazy>
+static void BM_transform_contiguous_chained(benchmark::State &state) {
+  run_contiguous<T>(
+      state,
+      [](auto &state_, const auto &a, const auto &b) {
+        for ([[maybe_unused]] auto _ : state_) {
+          Variable out;
+          if constexpr (lazy)
+            out = lazy::expr(a) * b + a / b;
+          else
+            out = a * b + a / b;
+          state_.PauseTiming();
+          out = Variable();
+          state_.ResumeTiming();
+        }
+      },
+      lazy ? 5 : 9);
+}
+
+// range(0) -> number of elements, up to the size of large detector arrays.
+BENCHMARK_TEMPLATE(BM_transform_contiguous_add, double)
+    ->RangeMultiplier(8)
+    ->Range(2 << 10, 2 << 26);
+BENCHMARK_TEMPLATE(BM_transform_contiguous_add, float)
+    ->RangeMultiplier(8)
+    ->Range(2 << 10, 2 << 26);
+BENCHMARK_TEMPLATE(BM_transform_contiguous_add, int64_t)
+    ->RangeMultiplier(8)
+    ->Range(2 << 10, 2 << 26);
+BENCHMARK_TEMPLATE(BM_transform_contiguous_add, int32_t)
+    ->RangeMultiplier(8)
+    ->Range(2 << 10, 2 << 26);
+BENCHMARK_TEMPLATE(BM_transform_contiguous_add_in_place, double)
+    ->RangeMultiplier(8)
+    ->Range(2 << 10, 2 << 26);
+BENCHMARK_TEMPLATE(BM_transform_contiguous_add_in_place, int64_t)
+    ->RangeMultiplier(8)
+    ->Range(2 << 10, 2 << 26);
+BENCHMARK_TEMPLATE(BM_transform_contiguous_sqrt, double)
+    ->RangeMultiplier(8)
+    ->Range(2 << 10, 2 << 26);
+BENCHMARK_TEMPLATE(BM_transform_contiguous_sqrt, float)
+    ->RangeMultiplier(8)
+    ->Range(2 << 10, 2 << 26);
+BENCHMARK_TEMPLATE(BM_transform_contiguous_sin, double)
+    ->RangeMultiplier(8)
+    ->Range(2 << 10, 2 << 26);
+BENCHMARK_TEMPLATE(BM_transform_contiguous_chained, double, false)
+    ->RangeMultiplier(8)
+    ->Range(2 << 10, 2 << 26);
+BENCHMARK_TEMPLATE(BM_transform_contiguous_chained, double, true)
+    ->RangeMultiplier(8)
+    ->Range(2 << 10, 2 << 26);
+
 // Arguments are:
 // range(0) -> ny
 // range(1) -> average nx (uniform distribution of events extents)
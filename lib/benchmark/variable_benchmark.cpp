@@ -7,6 +7,7 @@
 #include "variable_common.h"
 
 #include "scipp/variable/operations.h"
+#include "scipp/variable/shape.h"
 #include "scipp/variable/variable.h"
 
 using namespace scipp;
@@ -113,6 +114,25 @@ BENCHMARK_TEMPLATE(BM_Variable_copy, GenerateEvents<float>)
 BENCHMARK_TEMPLATE(BM_Variable_copy, GenerateEvents<double>)
     ->Apply(Args_Variable_copy_events);
 
+static void BM_Variable_copy_transposed(benchmark::State &state) {
+  const auto length = state.range(0);
+  const auto var = makeVariable<double>(Dims{Dim::Z, Dim::Y, Dim::X},
+                                        Shape{length, length, length});
+  const auto transposed =
+      transpose(var, std::vector<Dim>{Dim::Y, Dim::X, Dim::Z});
+  for (auto _ : state) {
+    Variable copied = copy(transposed);
+    state.PauseTiming();
+    copied = Variable();
+    state.ResumeTiming();
+  }
+  const auto size = sizeof(double) * var.dims().volume();
+  state.SetItemsProcessed(state.iterations() * var.dims().volume());
+  state.SetBytesProcessed(state.iterations() * size * 2);
+  state.counters["SizeBytes"] = size;
+}
+BENCHMARK(BM_Variable_copy_transposed)->Arg(64)->Arg(256)->Arg(512);
+
 static void BM_Variable_trivial_slice(benchmark::State &state) {
   auto var =
       makeVariable<double>(Dims{Dim::Z, Dim::Y, Dim::X}, Shape{10, 20, 30});
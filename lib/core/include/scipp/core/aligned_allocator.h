@@ -20,45 +20,22 @@ enum class Alignment : size_t {
 };
 
 namespace detail {
-void *allocate_aligned_memory(size_t align, size_t size);
-void deallocate_aligned_memory(void *ptr) noexcept;
-
-//#define USE_POOL
-
 template <typename T> constexpr bool is_power_of_two(T v) {
   return v && ((v & (v - 1)) == 0);
 }
 
+/// Allocate from the memory pool, which aligns all blocks to at least
+/// MemoryPool::alignment bytes.
 inline void *allocate_aligned_memory(size_t align, size_t size) {
   assert(align >= sizeof(void *));
   assert(is_power_of_two(align));
-
-  if (size == 0) {
-    return nullptr;
-  }
-
-#ifdef USE_POOL
-  return instance().allocate(size);
-#else
-  void *ptr = nullptr;
-  int rc = posix_memalign(&ptr, align, size);
-  if (rc != 0) {
-    return nullptr;
-  }
-  return ptr;
-#endif
+  assert(align <= MemoryPool::alignment);
+  static_cast<void>(align);
+  return memory_pool().allocate(size);
 }
 
-inline void deallocate_aligned_memory(void *ptr) noexcept {
-#ifdef USE_POOL
-  return instance().deallocate(ptr);
-#else
-#ifdef _WIN32
-  return _aligned_free(ptr);
-#else
-  return free(ptr);
-#endif
-#endif
+inline void deallocate_aligned_memory(void *ptr, size_t size) noexcept {
+  memory_pool().deallocate(ptr, size);
 }
 } // namespace detail
 
@@ -111,15 +88,16 @@ public:
                    typename AlignedAllocator<void, Align>::const_pointer = 0) {
     const size_type alignment = static_cast<size_type>(Align);
     void *ptr = detail::allocate_aligned_memory(alignment, n * sizeof(T));
-    if (ptr == nullptr) {
+    if (ptr == nullptr && n != 0) {
       throw std::bad_alloc();
     }
 
     return reinterpret_cast<pointer>(ptr);
   }
 
-  void deallocate(pointer p, size_type) noexcept {
-    return detail::deallocate_aligned_memory(p);
+  void deallocate(pointer p, size_type n) noexcept {
+    return detail::deallocate_aligned_memory(const_cast<T *>(p),
+                                             n * sizeof(T));
   }
 
   template <class U, class... Args> void construct(U *p, Args &&...args) {
@@ -163,15 +141,16 @@ public:
                    typename AlignedAllocator<void, Align>::const_pointer = 0) {
     const size_type alignment = static_cast<size_type>(Align);
     void *ptr = detail::allocate_aligned_memory(alignment, n * sizeof(T));
-    if (ptr == nullptr) {
+    if (ptr == nullptr && n != 0) {
       throw std::bad_alloc();
     }
 
     return reinterpret_cast<pointer>(ptr);
   }
 
-  void deallocate(pointer p, size_type) noexcept {
-    return detail::deallocate_aligned_memory(p);
+  void deallocate(pointer p, size_type n) noexcept {
+    return detail::deallocate_aligned_memory(const_cast<T *>(p),
+                                             n * sizeof(T));
   }
 
   template <class U, class... Args> void construct(U *p, Args &&...args) {
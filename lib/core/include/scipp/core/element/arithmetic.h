@@ -38,6 +38,16 @@ constexpr auto nan_add_equals =
                    a += b;
                }};
 
+/// Add `b` unless `mask` is true, for reductions ignoring masked elements.
+constexpr auto masked_add_equals = overloaded{
+    arg_list<std::tuple<double, double, bool>, std::tuple<double, float, bool>,
+             std::tuple<int64_t, int64_t, bool>,
+             std::tuple<int32_t, int32_t, bool>>,
+    [](auto &&a, const auto &b, const bool mask) {
+      if (!mask)
+        a += b;
+    }};
+
 constexpr auto subtract_equals =
     overloaded{add_inplace_types<>, [](auto &&a, const auto &b) { a -= b; }};
 
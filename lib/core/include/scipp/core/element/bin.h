@@ -82,12 +82,12 @@ static constexpr auto update_indices_by_binning_sorted_edges =
                [](auto &index, const auto &x, const auto &edges) {
                  if (index == -1)
                    return;
-                 auto it = std::upper_bound(edges.begin(), edges.end(), x);
+                 const auto bin = core::upper_bound_index(edges, x);
                  index *= scipp::size(edges) - 1;
-                 if (it == edges.begin() || it == edges.end()) {
+                 if (bin == 0 || bin == scipp::size(edges)) {
                    index = -1;
                  } else {
-                   index += --it - edges.begin();
+                   index += bin - 1;
                  }
                }};
 
@@ -143,4 +143,29 @@ constexpr auto nanmin_equals =
                    a = min(a, b);
                }};
 
+constexpr auto masked_minmax_types =
+    arg_list<std::tuple<double, double, bool>, std::tuple<float, float, bool>,
+             std::tuple<int64_t, int64_t, bool>,
+             std::tuple<int32_t, int32_t, bool>>;
+
+/// Like `max_equals`, but leave `a` unchanged if `mask` is true.
+constexpr auto masked_max_equals =
+    overloaded{masked_minmax_types,
+               transform_flags::expect_in_variance_if_out_variance,
+               [](auto &&a, const auto &b, const bool mask) {
+                 using std::max;
+                 if (!mask)
+                   a = max(a, b);
+               }};
+
+/// Like `min_equals`, but leave `a` unchanged if `mask` is true.
+constexpr auto masked_min_equals =
+    overloaded{masked_minmax_types,
+               transform_flags::expect_in_variance_if_out_variance,
+               [](auto &&a, const auto &b, const bool mask) {
+                 using std::min;
+                 if (!mask)
+                   a = min(a, b);
+               }};
+
 } // namespace scipp::core::element
@@ -95,17 +95,17 @@ constexpr auto map_linspace =
 constexpr auto map_sorted_edges =
     overloaded{map, [](const auto &coord, const auto &edges,
                        const auto &weights, const auto &fill) {
-                 auto it = std::upper_bound(edges.begin(), edges.end(), coord);
-                 return (it == edges.end() || it == edges.begin())
+                 const auto bin = upper_bound_index(edges, coord);
+                 return (bin == scipp::size(edges) || bin == 0)
                             ? fill
-                            : get(weights, --it - edges.begin());
+                            : get(weights, bin - 1);
                }};
 
 constexpr auto lookup_previous =
     overloaded{map, [](const auto &point, const auto &x, const auto &weights,
                        const auto &fill) {
-                 auto it = std::upper_bound(x.begin(), x.end(), point);
-                 return it == x.begin() ? fill : get(weights, --it - x.begin());
+                 const auto i = upper_bound_index(x, point);
+                 return i == 0 ? fill : get(weights, i - 1);
                }};
 
 namespace map_and_mul_detail {
@@ -147,11 +147,11 @@ constexpr auto map_and_mul_linspace =
 constexpr auto map_and_mul_sorted_edges =
     overloaded{map_and_mul, [](auto &data, const auto coord, const auto &edges,
                                const auto &weights) {
-                 auto it = std::upper_bound(edges.begin(), edges.end(), coord);
-                 if (it == edges.end() || it == edges.begin())
+                 const auto bin = upper_bound_index(edges, coord);
+                 if (bin == scipp::size(edges) || bin == 0)
                    data *= 0.0;
                  else
-                   data *= get(weights, --it - edges.begin());
+                   data *= get(weights, bin - 1);
                }};
 
 } // namespace scipp::core::element::event
@@ -4,12 +4,15 @@
 /// @author Simon Heybrock
 #pragma once
 #include <limits>
+#include <utility>
+#include <vector>
 
 #include "scipp/common/overloaded.h"
 #include "scipp/core/eigen.h"
 #include "scipp/core/element/arg_list.h"
 #include "scipp/core/element/util.h"
 #include "scipp/core/histogram.h"
+#include "scipp/core/parallel.h"
 #include "scipp/core/subbin_sizes.h"
 #include "scipp/core/time_point.h"
 #include "scipp/core/transform_common.h"
@@ -33,6 +36,57 @@ auto map_to_bins_direct = [](auto &binned, auto &bins, const auto &data,
   }
 };
 
+namespace map_to_bins_detail {
+/// Minimum number of events per chunk when splitting a single input bin
+/// across threads.
+constexpr scipp::index min_events_per_chunk = 65536;
+constexpr scipp::index max_chunks = 24;
+
+template <class T>
+auto subspan(const T &data, const scipp::index begin,
+             const scipp::index size) {
+  if constexpr (is_ValueAndVariance_v<T>)
+    return ValueAndVariance{data.value.subspan(begin, size),
+                            data.variance.subspan(begin, size)};
+  else
+    return data.subspan(begin, size);
+}
+
+/// Maximum total capacity in bytes of the scratch buffers of one thread that
+/// is kept after an application of `map_to_bins_chunkwise`.
+constexpr size_t max_retained_chunk_bytes = size_t{1} << 20;
+
+/// Return per-thread scratch buffers for `map_to_bins_chunkwise`.
+///
+/// The buffers are reused by all applications of the kernel on the calling
+/// thread, instead of being allocated for every input bin. They grow to fit
+/// the largest input seen, but are freed by `trim_chunk_buffers` if their
+/// capacity exceeds `max_retained_chunk_bytes`. The first `nchunk` buffers are
+/// returned empty.
+template <class T, class InnerIndex>
+auto &chunk_buffers(const scipp::index nchunk) {
+  thread_local std::vector<std::tuple<std::vector<T>, std::vector<InnerIndex>>>
+      chunks;
+  if (scipp::size(chunks) < nchunk)
+    chunks.resize(nchunk);
+  // Normally a no-op, unless a previous application of the kernel threw.
+  for (scipp::index i = 0; i < nchunk; ++i) {
+    std::get<0>(chunks[i]).clear();
+    std::get<1>(chunks[i]).clear();
+  }
+  return chunks;
+}
+
+template <class Chunks> void trim_chunk_buffers(Chunks &chunks) {
+  size_t bytes = chunks.capacity() * sizeof(typename Chunks::value_type);
+  for (const auto &[vals, ind] : chunks)
+    bytes +=
+        vals.capacity() * sizeof(vals[0]) + ind.capacity() * sizeof(ind[0]);
+  if (bytes > max_retained_chunk_bytes)
+    Chunks().swap(chunks);
+}
+} // namespace map_to_bins_detail
+
 constexpr bool is_powerof2(int v) { return v && ((v & (v - 1)) == 0); }
 
 template <int chunksize>
@@ -47,11 +101,10 @@ auto map_to_bins_chunkwise = [](auto &binned, auto &bins, const auto &data,
 
   using Val =
       std::conditional_t<is_ValueAndVariance_v<T>, typename T::value_type, T>;
-  // TODO Ideally this buffer would be reused (on a per-thread basis)
-  // for every application of the kernel.
-  std::vector<std::tuple<std::vector<typename Val::value_type>,
-                         std::vector<InnerIndex>>>
-      chunks((bins.size() - 1) / chunksize + 1);
+  const scipp::index nchunk = (bins.size() - 1) / chunksize + 1;
+  auto &chunks =
+      map_to_bins_detail::chunk_buffers<typename Val::value_type, InnerIndex>(
+          nchunk);
   for (scipp::index i = 0; i < size;) {
     // We operate in blocks so the size of the map of buffers, i.e.,
     // additional memory use of the algorithm, is bounded. This also
@@ -74,7 +127,7 @@ auto map_to_bins_chunkwise = [](auto &binned, auto &bins, const auto &data,
       ind.emplace_back(j);
     }
     // 2. Map chunks to bins
-    for (scipp::index i_chunk = 0; i_chunk < scipp::size(chunks); ++i_chunk) {
+    for (scipp::index i_chunk = 0; i_chunk < nchunk; ++i_chunk) {
       auto &[vals, ind] = chunks[i_chunk];
       for (scipp::index j = 0; j < scipp::size(ind); ++j) {
         const auto i_bin = chunksize * i_chunk + ind[j];
@@ -89,6 +142,96 @@ auto map_to_bins_chunkwise = [](auto &binned, auto &bins, const auto &data,
       ind.clear();
     }
   }
+  map_to_bins_detail::trim_chunk_buffers(chunks);
+};
+
+auto map_to_bins_serial = [](auto &binned, auto &bins, const auto &data,
+                             const auto &bin_indices) {
+  // If there are many bins, we have two performance issues:
+  // 1. `bins` is large and will not fit into L1, L2, or L3 cache.
+  // 2. Writes to output are very random, implying a cache miss for every
+  //    event.
+  // We can avoid some of this issue by first sorting into chunks, then
+  // chunks into bins. For example, instead of mapping directly to 65536
+  // bins, we may map to 256 chunks, and each chunk to 256 bins.
+  const bool many_bins = bins.size() > 512;
+  const bool multiple_events_per_bin = bins.size() * 4 < bin_indices.size();
+  if (many_bins && multiple_events_per_bin) { // avoid overhead
+    if (bins.size() <= 128 * 128)
+      map_to_bins_chunkwise<128>(binned, bins, data, bin_indices);
+    else if (bins.size() <= 256 * 256)
+      map_to_bins_chunkwise<256>(binned, bins, data, bin_indices);
+    else if (bins.size() <= 512 * 512)
+      map_to_bins_chunkwise<512>(binned, bins, data, bin_indices);
+    else
+      map_to_bins_chunkwise<1024>(binned, bins, data, bin_indices);
+  } else {
+    map_to_bins_direct(binned, bins, data, bin_indices);
+  }
+};
+
+/// Return the number of chunks to use for mapping `nevent` events to `nbin`
+/// bins with `map_to_bins_parallel`, or 1 if it is not worth threading.
+///
+/// Every chunk requires a count for every bin, so the number of chunks is
+/// limited such that the counts are small compared to the events.
+inline scipp::index map_to_bins_nchunk(const scipp::index nevent,
+                                       const scipp::index nbin) {
+  using namespace map_to_bins_detail;
+  return std::min(max_chunks,
+                  nevent / std::max(min_events_per_chunk, 8 * nbin));
+}
+
+/// Map events to bins using `nchunk` threads, equivalent to
+/// `map_to_bins_direct`.
+///
+/// This is a counting sort: 1. Count events per bin for every chunk of events.
+/// 2. Exclusive scan of the counts over chunks, yielding the output position of
+/// the first event of every chunk in every bin. 3. Scatter the chunks
+/// concurrently, each into a disjoint range of every bin. The output order
+/// within bins is therefore the same as for the serial implementation.
+auto map_to_bins_parallel = [](auto &binned, auto &bins, const auto &data,
+                               const auto &bin_indices,
+                               const scipp::index nchunk) {
+  const auto nevent = scipp::size(bin_indices);
+  const auto nbin = scipp::size(bins);
+  const auto chunk_begin = [nevent, nchunk](const scipp::index chunk) {
+    return nevent * chunk / nchunk;
+  };
+  std::vector<scipp::index> chunk_bins(static_cast<size_t>(nchunk * nbin));
+  core::parallel::parallel_for(
+      core::parallel::blocked_range(0, nchunk), [&](const auto &range) {
+        for (auto chunk = range.begin(); chunk < range.end(); ++chunk) {
+          auto *counts = chunk_bins.data() + chunk * nbin;
+          for (auto i = chunk_begin(chunk); i < chunk_begin(chunk + 1); ++i)
+            if (const auto i_bin = bin_indices[i]; i_bin >= 0)
+              ++counts[i_bin];
+        }
+      });
+  core::parallel::parallel_for(
+      core::parallel::blocked_range(0, nbin), [&](const auto &range) {
+        for (auto bin = range.begin(); bin < range.end(); ++bin) {
+          auto current = bins[bin];
+          for (scipp::index chunk = 0; chunk < nchunk; ++chunk) {
+            auto &count = chunk_bins[chunk * nbin + bin];
+            current += std::exchange(count, current);
+          }
+          bins[bin] = current;
+        }
+      });
+  core::parallel::parallel_for(
+      core::parallel::blocked_range(0, nchunk), [&](const auto &range) {
+        for (auto chunk = range.begin(); chunk < range.end(); ++chunk) {
+          const auto begin = chunk_begin(chunk);
+          const auto size = chunk_begin(chunk + 1) - begin;
+          scipp::span<scipp::index> local_bins(
+              chunk_bins.data() + chunk * nbin, nbin);
+          map_to_bins_serial(
+              binned, local_bins,
+              map_to_bins_detail::subspan(data, begin, size),
+              map_to_bins_detail::subspan(bin_indices, begin, size));
+        }
+      });
 };
 
 // - Each span covers an *input* bin.
@@ -113,27 +256,15 @@ static constexpr auto bin = overloaded{
     [](const auto &binned, const auto &offsets, const auto &data,
        const auto &bin_indices) {
       auto bins(offsets.sizes());
-      // If there are many bins, we have two performance issues:
-      // 1. `bins` is large and will not fit into L1, L2, or L3 cache.
-      // 2. Writes to output are very random, implying a cache miss for every
-      //    event.
-      // We can avoid some of this issue by first sorting into chunks, then
-      // chunks into bins. For example, instead of mapping directly to 65536
-      // bins, we may map to 256 chunks, and each chunk to 256 bins.
-      const bool many_bins = bins.size() > 512;
-      const bool multiple_events_per_bin = bins.size() * 4 < bin_indices.size();
-      if (many_bins && multiple_events_per_bin) { // avoid overhead
-        if (bins.size() <= 128 * 128)
-          map_to_bins_chunkwise<128>(binned, bins, data, bin_indices);
-        else if (bins.size() <= 256 * 256)
-          map_to_bins_chunkwise<256>(binned, bins, data, bin_indices);
-        else if (bins.size() <= 512 * 512)
-          map_to_bins_chunkwise<512>(binned, bins, data, bin_indices);
-        else
-          map_to_bins_chunkwise<1024>(binned, bins, data, bin_indices);
-      } else {
-        map_to_bins_direct(binned, bins, data, bin_indices);
-      }
+      // A single input bin may hold all events, e.g., when binning a flat
+      // table. The transform over input bins then has a single work item, so
+      // we split the events across threads here.
+      const auto nchunk =
+          map_to_bins_nchunk(scipp::size(bin_indices), scipp::size(bins));
+      if (nchunk > 1)
+        map_to_bins_parallel(binned, bins, data, bin_indices, nchunk);
+      else
+        map_to_bins_serial(binned, bins, data, bin_indices);
     }};
 
 } // namespace scipp::core::element
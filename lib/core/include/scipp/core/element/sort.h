@@ -4,9 +4,14 @@
 /// @author Thibault Chatel
 #pragma once
 
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
 #include "scipp/common/overloaded.h"
 #include "scipp/core/element/arg_list.h"
 #include "scipp/core/element/comparison.h"
+#include "scipp/core/radix_sort.h"
 #include "scipp/core/time_point.h"
 #include "scipp/core/transform_common.h"
 #include "scipp/core/value_and_variance.h"
@@ -14,28 +19,59 @@
 
 namespace scipp::core::element {
 
+namespace sort_detail {
+template <bool Descending, class T> auto key(const T &x) {
+  return Descending ? ~radix_key(x) : radix_key(x);
+}
+
+/// Stably sort `values` and permute `variances` alongside, if given.
+///
+/// Large spans are radix sorted, for small spans a permutation is sorted and
+/// applied, i.e., values and variances are never zipped into a buffer.
+template <bool Descending, class T, class... Variances>
+void sort_by_key(scipp::span<T> values, Variances... variances) {
+  const auto n = scipp::size(values);
+  if (n >= radix_sort_min_size) {
+    std::vector<radix_key_t<T>> keys(n);
+    std::transform(values.begin(), values.end(), keys.begin(),
+                   [](const T &x) { return key<Descending>(x); });
+    radix_sort(keys.data(), n, values.data(), variances.data()...);
+  } else if constexpr (sizeof...(Variances) == 0) {
+    std::stable_sort(values.begin(), values.end(),
+                     [](const T &a, const T &b) {
+                       return key<Descending>(a) < key<Descending>(b);
+                     });
+  } else {
+    std::vector<int32_t> perm(n);
+    std::iota(perm.begin(), perm.end(), 0);
+    std::stable_sort(perm.begin(), perm.end(), [&values](auto a, auto b) {
+      return key<Descending>(values[a]) < key<Descending>(values[b]);
+    });
+    std::vector<T> buffer(n);
+    for (auto &&span : {values, variances...}) {
+      for (scipp::index i = 0; i < n; ++i)
+        buffer[i] = span[perm[i]];
+      std::copy(buffer.begin(), buffer.end(), span.begin());
+    }
+  }
+}
+} // namespace sort_detail
+
 namespace {
-template <class Compare> constexpr auto make_sort(Compare compare) {
+template <bool Descending, class Compare>
+constexpr auto make_sort(Compare compare) {
   return overloaded{
       core::element::arg_list<scipp::span<int64_t>, scipp::span<int32_t>,
                               scipp::span<double>, scipp::span<float>,
                               scipp::span<std::string>,
                               scipp::span<time_point>>,
       [](units::Unit &) {},
-      [&compare](auto &range) {
+      [compare](auto &range) {
         using T = std::decay_t<decltype(range)>;
-        constexpr bool vars = is_ValueAndVariance_v<T>;
-        if constexpr (vars) {
-          std::vector<ValueAndVariance<typename T::value_type::value_type>>
-              zipped;
-          for (scipp::index i = 0; i < scipp::size(range.value); i++) {
-            zipped.emplace_back(range.value[i], range.variance[i]);
-          }
-          std::sort(std::begin(zipped), std::end(zipped), compare);
-          for (scipp::index i = 0; i < scipp::size(range.value); i++) {
-            range.value[i] = zipped[i].value;
-            range.variance[i] = zipped[i].variance;
-          }
+        if constexpr (is_ValueAndVariance_v<T>) {
+          sort_detail::sort_by_key<Descending>(range.value, range.variance);
+        } else if constexpr (is_radix_sortable_v<typename T::value_type>) {
+          sort_detail::sort_by_key<Descending>(range);
         } else {
           std::sort(range.begin(), range.end(), compare);
         }
@@ -43,7 +79,7 @@ template <class Compare> constexpr auto make_sort(Compare compare) {
 }
 } // namespace
 
-auto sort_nonascending = make_sort(greater);
-auto sort_nondescending = make_sort(less);
+auto sort_nonascending = make_sort<true>(greater);
+auto sort_nondescending = make_sort<false>(less);
 
 } // namespace scipp::core::element
@@ -6,26 +6,64 @@
 
 #include <algorithm>
 #include <memory>
+#include <stdexcept>
+#include <type_traits>
 
 #include "scipp/common/index.h"
+#include "scipp/core/memory_pool.h"
 #include "scipp/core/parallel.h"
 
 namespace scipp::core {
 
+/// True if buffers of T can be obtained from MemoryPool as raw memory.
+template <class T>
+constexpr bool is_pool_allocatable_v =
+    std::is_trivially_default_constructible_v<T> &&
+    std::is_trivially_destructible_v<T>;
+
+/// Deleter for arrays created by make_unique_for_overwrite_array.
+///
+/// Stores the size since MemoryPool requires it for deallocation. If `owner`
+/// is set the memory is owned externally and only the reference to the owner
+/// is released.
+template <class T> struct element_array_deleter {
+  scipp::index size{0};
+  std::shared_ptr<void> owner{};
+
+  void operator()(T *ptr) noexcept {
+    if (owner)
+      owner.reset();
+    else if constexpr (is_pool_allocatable_v<T>)
+      memory_pool().deallocate(ptr, sizeof(T) * size);
+    else
+      delete[] ptr;
+  }
+};
+
 /// Replacement for C++20 std::make_unique_for_overwrite
+///
+/// Buffers of trivial types are allocated from the memory pool.
 template <class T>
 auto make_unique_for_overwrite_array(const scipp::index size) {
   // This is specifically written in this way to avoid an internal cppcheck
   // error which happens when we try to handle both arrays and 'normal' pointers
   // using std::remove_extent_t<T> as the type we pass to the unique_ptr.
-  using Ptr = std::unique_ptr<T[]>;
-  return Ptr(new T[size]);
+  using Ptr = std::unique_ptr<T[], element_array_deleter<T>>;
+  if constexpr (is_pool_allocatable_v<T>)
+    return Ptr(static_cast<T *>(memory_pool().allocate(sizeof(T) * size)),
+               element_array_deleter<T>{size});
+  else
+    return Ptr(new T[size], element_array_deleter<T>{size});
 }
 
 /// Tag for requesting default-initialization in methods of class element_array.
 struct init_for_overwrite_t {};
 static constexpr auto init_for_overwrite = init_for_overwrite_t{};
 
+/// Tag for wrapping externally owned memory in class element_array.
+struct borrow_t {};
+static constexpr auto borrow = borrow_t{};
+
 /// Internal data container for Variable.
 ///
 /// This provides a vector-like storage for arrays of elements in a variable.
@@ -38,6 +76,9 @@ static constexpr auto init_for_overwrite = init_for_overwrite_t{};
 /// - As a minor benefit, since the implementation has to store a pointer and a
 ///   size, we can at the same time support an "optional" behavior, as used for
 ///   the array of variances in a variable.
+/// - Wrapping externally owned memory without a copy, e.g., a NumPy buffer.
+///   Writes go to the external memory, but copies and resizes always allocate
+///   owned memory.
 template <class T> class element_array {
 public:
   using value_type = T;
@@ -46,10 +87,14 @@ public:
 
   explicit element_array(const scipp::index new_size, const T &value = T()) {
     resize(new_size, init_for_overwrite);
+    // First touch with the same partitioning as used by transform, such that
+    // pages are allocated on the NUMA node of the threads processing them.
     parallel::parallel_for(
-        parallel::blocked_range(0, size()), [&](const auto &range) {
+        parallel::blocked_range_by_work(0, size(), sizeof(T)),
+        [&](const auto &range) {
           std::fill(data() + range.begin(), data() + range.end(), value);
-        });
+        },
+        parallel::static_partitioner{});
   }
 
   /// Construct with default-initialized elements.
@@ -58,6 +103,21 @@ public:
     resize(new_size, init_for_overwrite);
   }
 
+  /// Wrap `size` elements at `data` without copying.
+  ///
+  /// The memory must remain valid while `owner` is alive. A reference to
+  /// `owner` is held until the array is destroyed, reset, or resized.
+  element_array(T *data, const scipp::index size, std::shared_ptr<void> owner,
+                const borrow_t &)
+      : m_size(size) {
+    static_assert(is_pool_allocatable_v<T>,
+                  "Only trivial types can wrap external memory.");
+    if (!owner)
+      throw std::invalid_argument("Wrapped memory requires an owner.");
+    m_data = std::unique_ptr<T[], element_array_deleter<T>>(
+        data, element_array_deleter<T>{size, std::move(owner)});
+  }
+
   template <
       class Iter,
       std::enable_if_t<
@@ -66,10 +126,12 @@ public:
     const scipp::index size = std::distance(first, last);
     resize(size, init_for_overwrite);
     parallel::parallel_for(
-        parallel::blocked_range(0, size), [&](const auto &range) {
+        parallel::blocked_range_by_work(0, size, sizeof(T)),
+        [&](const auto &range) {
           std::copy(first + range.begin(), first + range.end(),
                     data() + range.begin());
-        });
+        },
+        parallel::static_partitioner{});
   }
 
   template <
@@ -102,6 +164,10 @@ public:
   }
 
   explicit operator bool() const noexcept { return m_size != -1; }
+  /// Return true if the elements are stored in externally owned memory.
+  bool is_borrowed() const noexcept {
+    return static_cast<bool>(m_data.get_deleter().owner);
+  }
   scipp::index size() const noexcept { return m_size; }
   [[nodiscard]] bool empty() const noexcept { return size() == 0; }
   const T *data() const noexcept { return m_data.get(); }
@@ -125,11 +191,13 @@ public:
   void resize(const scipp::index new_size) { *this = element_array(new_size); }
 
   /// Resize with default-initialized elements. Use with care.
+  ///
+  /// Borrowed memory is never reused, i.e., this detaches from the owner.
   void resize(const scipp::index new_size, const init_for_overwrite_t &) {
     if (new_size == 0) {
       m_data.reset();
       m_size = 0;
-    } else if (new_size != size()) {
+    } else if (new_size != size() || is_borrowed()) {
       m_data = make_unique_for_overwrite_array<T>(new_size);
       m_size = new_size;
     }
@@ -146,7 +214,7 @@ private:
     }
   }
   scipp::index m_size{-1};
-  std::unique_ptr<T[]> m_data;
+  std::unique_ptr<T[], element_array_deleter<T>> m_data;
 };
 
 } // namespace scipp::core
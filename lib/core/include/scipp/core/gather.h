@@ -0,0 +1,80 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+#pragma once
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "scipp/common/index.h"
+#include "scipp/core/parallel.h"
+
+namespace scipp::core {
+
+namespace gather_detail {
+/// Number of indices processed by a single task of `gather`, such that the
+/// indices of a block stay in cache while visiting all outer rows.
+constexpr scipp::index index_block = 4096;
+} // namespace gather_detail
+
+/// Gather rows of a contiguous array with shape (outer, size, inner).
+///
+/// For every outer row `o` and every `i` in [0, nindex) the `inner` elements
+/// at position `indices[i]` of `src` are copied to position `i` of `dst`, i.e.,
+/// `dst` has shape (outer, nindex, inner). The work is split into tasks of
+/// blocks of indices, which are processed in parallel.
+template <class T, class Index>
+void gather(const T *src, T *dst, const Index *indices,
+            const scipp::index nindex, const scipp::index size,
+            const scipp::index outer, const scipp::index inner) {
+  using gather_detail::index_block;
+  if (nindex == 0 || outer == 0 || inner == 0)
+    return;
+  const auto nblock = (nindex + index_block - 1) / index_block;
+  parallel::parallel_for(
+      parallel::blocked_range_by_work(
+          0, outer * nblock,
+          2 * static_cast<scipp::index>(sizeof(T)) * index_block * inner),
+      [&](const auto &range) {
+        for (auto task = range.begin(); task != range.end(); ++task) {
+          const auto o = task / nblock;
+          const auto begin = (task % nblock) * index_block;
+          const auto end = std::min(begin + index_block, nindex);
+          const T *in = src + o * size * inner;
+          T *out = dst + (o * nindex + begin) * inner;
+          if (inner == 1) {
+            for (auto i = begin; i < end; ++i)
+              *out++ = in[indices[i]];
+          } else {
+            for (auto i = begin; i < end; ++i, out += inner)
+              std::copy_n(in + indices[i] * inner, inner, out);
+          }
+        }
+      });
+}
+
+/// Return the permutation that stably sorts the `size` elements accessed by
+/// `key(i)` according to `less`.
+///
+/// In contrast to sorting pairs of keys and indices, only the permutation is
+/// allocated and sorted and keys are read from the input. Ties are broken by
+/// index, so the result does not depend on the number of threads.
+template <class Index, class Key, class Less>
+std::vector<Index> argsort(const scipp::index size, Key key, Less less) {
+  std::vector<Index> perm(size);
+  std::iota(perm.begin(), perm.end(), Index{0});
+  parallel::parallel_sort(perm.begin(), perm.end(),
+                          [&](const Index a, const Index b) {
+                            const auto &ka = key(a);
+                            const auto &kb = key(b);
+                            if (less(ka, kb))
+                              return true;
+                            if (less(kb, ka))
+                              return false;
+                            return a < b;
+                          });
+  return perm;
+}
+
+} // namespace scipp::core
@@ -5,9 +5,17 @@
 #pragma once
 
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
 #include <tuple>
+#include <type_traits>
+#include <vector>
 
+#include "scipp/common/index.h"
+#include "scipp/common/span.h"
 #include "scipp/core/except.h"
+#include "scipp/core/time_point.h"
 
 namespace scipp::core {
 
@@ -20,6 +28,150 @@ constexpr static auto linear_edge_params = [](const auto &edges) {
   return std::tuple{offset, nbin, scale};
 };
 
+/// Return the index of the first edge greater than `x`.
+///
+/// Equivalent to `std::upper_bound(edges.begin(), edges.end(), x)` but without
+/// data-dependent branches: The number of iterations depends only on the size
+/// of `edges` and the comparison result is used arithmetically, so there are
+/// no mispredicted branches for random input. `edges` must be sorted.
+template <class Edges, class T>
+scipp::index upper_bound_index(const Edges &edges, const T &x) noexcept {
+  scipp::index n = scipp::size(edges);
+  if (n == 0)
+    return 0;
+  const auto *const base = edges.data();
+  const auto *first = base;
+  while (n > 1) {
+    const auto half = n / 2;
+    first = x < first[half] ? first : first + half;
+    n -= half;
+  }
+  return (first - base) + !(x < *first);
+}
+
+/// Precomputed index for repeated lookup of values in sorted bin edges.
+///
+/// The value range of the edges is split into uniform buckets. For each bucket
+/// the table stores the index of the first edge in that bucket, so a lookup
+/// computes the bucket of the value and performs a short branchless search
+/// over the few edges inside the bucket. Buckets are either linear in the
+/// value or, for positive floating-point edges, linear in the bit pattern of
+/// the value, which is approximately logarithmic. The layout with the fewest
+/// edges per bucket is used. Since the bucket is a monotonic function of the
+/// value, the result is exact and identical to `std::upper_bound`.
+template <class Edge> class SortedEdgeIndex {
+public:
+  explicit SortedEdgeIndex(const scipp::span<const Edge> edges)
+      : m_edges(edges) {
+    build(false);
+    if constexpr (std::is_floating_point_v<Edge>) {
+      if (!m_edges.empty() && m_edges.front() > Edge{0}) {
+        const auto linear_width = m_max_width;
+        auto linear_table = std::move(m_table);
+        const auto linear_params = std::tuple{m_offset, m_scale};
+        build(true);
+        if (m_max_width >= linear_width) {
+          m_log = false;
+          m_max_width = linear_width;
+          m_table = std::move(linear_table);
+          std::tie(m_offset, m_scale) = linear_params;
+        }
+      }
+    }
+  }
+
+  /// Return the index of the first edge greater than `x`.
+  ///
+  /// `x` is compared with the edges in the common type of `T` and `Edge`, it is
+  /// not converted to `Edge`.
+  template <class T> scipp::index upper_bound(const T &x) const noexcept {
+    const auto b = bucket(x);
+    const auto begin = m_table[b];
+    return begin +
+           upper_bound_index(m_edges.subspan(begin, m_table[b + 1] - begin), x);
+  }
+
+  /// Return true if the index is log-spaced, for testing.
+  [[nodiscard]] bool is_log() const noexcept { return m_log; }
+
+private:
+  /// Monotonic (non-decreasing) map from a value to the bucket coordinate.
+  ///
+  /// The same map is used for edges and for values of other types, so the
+  /// conversions must preserve order across types. Conversion to `double` and
+  /// narrowing of floating-point values to `Edge` do.
+  template <class T> double key(const T &x) const noexcept {
+    if constexpr (std::is_floating_point_v<Edge>) {
+      if (m_log) {
+        // The bit pattern of a positive IEEE float is monotonic in its value.
+        using Int = std::conditional_t<sizeof(Edge) == 8, int64_t, int32_t>;
+        const auto value = narrow(x);
+        Int bits;
+        std::memcpy(&bits, &value, sizeof(Edge));
+        return static_cast<double>(bits);
+      }
+      return static_cast<double>(x);
+    } else if constexpr (std::is_same_v<T, time_point>) {
+      return static_cast<double>(x.time_since_epoch());
+    } else {
+      return static_cast<double>(x);
+    }
+  }
+
+  /// Convert to `Edge`, saturating to infinity outside the range of `Edge`.
+  template <class T> static Edge narrow(const T &x) noexcept {
+    if constexpr (std::is_floating_point_v<T> && sizeof(T) > sizeof(Edge)) {
+      constexpr auto inf = std::numeric_limits<Edge>::infinity();
+      if (x > std::numeric_limits<Edge>::max())
+        return inf;
+      if (x < std::numeric_limits<Edge>::lowest())
+        return -inf;
+    }
+    return static_cast<Edge>(x);
+  }
+
+  template <class T> scipp::index bucket(const T &x) const noexcept {
+    const auto last = nbucket() - 1;
+    // NaN maps to the last bucket, consistent with std::upper_bound.
+    if constexpr (std::is_floating_point_v<T>)
+      if (x != x)
+        return last;
+    const double b = (key(x) - m_offset) * m_scale;
+    if (!(b < static_cast<double>(last)))
+      return last;
+    return b < 0.0 ? 0 : static_cast<scipp::index>(b);
+  }
+
+  [[nodiscard]] scipp::index nbucket() const noexcept {
+    return scipp::size(m_table) - 1;
+  }
+
+  void build(const bool log) {
+    m_log = log;
+    const auto nedge = scipp::size(m_edges);
+    const auto n = std::max(scipp::index{1}, 2 * nedge);
+    m_table.assign(n + 1, nedge);
+    m_offset = nedge == 0 ? 0.0 : key(m_edges.front());
+    const auto range = nedge == 0 ? 0.0 : key(m_edges.back()) - m_offset;
+    m_scale = range > 0.0 ? static_cast<double>(n) / range : 0.0;
+    for (scipp::index i = nedge - 1; i >= 0; --i)
+      m_table[bucket(m_edges[i])] = i;
+    // Empty buckets start at the first edge of the next non-empty bucket.
+    for (scipp::index b = n - 1; b >= 0; --b)
+      m_table[b] = std::min(m_table[b], m_table[b + 1]);
+    m_max_width = 0;
+    for (scipp::index b = 0; b < n; ++b)
+      m_max_width = std::max(m_max_width, m_table[b + 1] - m_table[b]);
+  }
+
+  scipp::span<const Edge> m_edges;
+  std::vector<scipp::index> m_table;
+  double m_offset{0.0};
+  double m_scale{0.0};
+  scipp::index m_max_width{0};
+  bool m_log{false};
+};
+
 namespace expect::histogram {
 template <class T> void sorted_edges(const T &edges) {
   if (!std::is_sorted(edges.begin(), edges.end()))
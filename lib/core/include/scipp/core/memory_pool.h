@@ -5,94 +5,124 @@
 #pragma once
 
 #include <array>
-#include <map>
+#include <atomic>
+#include <cstddef>
 #include <mutex>
 #include <vector>
 
+#include "scipp-core_export.h"
 #include "scipp/common/index.h"
 
 namespace scipp::core {
-#ifdef _WIN32
-// https://stackoverflow.com/questions/33696092/whats-the-correct-replacement-for-posix-memalign-in-windows
-static int check_align(size_t align) {
-  for (size_t i = sizeof(void *); i != 0; i *= 2)
-    if (align == i)
-      return 0;
-  return EINVAL;
-}
-
-static int posix_memalign(void **ptr, size_t align, size_t size) {
-  if (check_align(align))
-    return EINVAL;
-
-  int saved_errno = errno;
-  void *p = _aligned_malloc(size, align);
-  if (p == NULL) {
-    errno = saved_errno;
-    return ENOMEM;
-  }
 
-  *ptr = p;
-  return 0;
-}
-#endif
+class MemoryPoolThreadCache;
 
-class MemoryPool {
-public:
-  void *allocate(size_t size) const {
-    std::lock_guard<std::mutex> g(m_mutex);
-    auto &pools = m_pools[size];
-    if (pools[1].empty()) {
-      void *ptr = nullptr;
-      // Always 64 bit aligned
-      int rc = posix_memalign(&ptr, 64, size);
-      if (rc != 0)
-        throw std::runtime_error("Failed to allocate.");
-      pools[0].emplace_back(ptr);
-      return ptr;
-    } else {
-      pools[0].emplace_back(pools[1].back());
-      pools[1].pop_back();
-      return pools[0].back();
-    }
+/// Allocation statistics of MemoryPool.
+struct MemoryPoolStats {
+  /// Bytes handed out by the pool and not returned yet.
+  scipp::index bytes_live{0};
+  /// Bytes of freed blocks held by the pool for reuse.
+  scipp::index bytes_cached{0};
+  /// Number of allocations served from cached blocks.
+  scipp::index hits{0};
+  /// Number of allocations that required memory from the system.
+  scipp::index misses{0};
+
+  [[nodiscard]] double hit_rate() const noexcept {
+    const auto total = hits + misses;
+    return total == 0 ? 0.0 : static_cast<double>(hits) / total;
   }
-  void deallocate(void *ptr) const {
-    std::lock_guard<std::mutex> g(m_mutex);
-    for (auto &pools : m_pools) {
-      auto &used = pools.second[0];
-      for (scipp::index i = used.size() - 1; i >= 0; --i) {
-        if (used[i] == ptr) {
-          auto &unused = pools.second[1];
-          used.erase(used.begin() + i);
-          unused.emplace_back(ptr);
-          return;
-        }
-      }
-    }
-    throw std::runtime_error(
-        "Request to deallocate memory that is not owned by us.");
+};
+
+/// Pooled allocator for the buffers of element_array and AlignedAllocator.
+///
+/// Allocations are rounded up to size classes with four classes per power of
+/// two. Freed blocks are kept in a small per-thread cache and in a lock-free
+/// global free list of their size class, so temporaries of the same size that
+/// are created and destroyed repeatedly (as, e.g., in reductions) do not have
+/// to be page-faulted in again. The total number of cached bytes is limited by
+/// `max_cached_bytes`, blocks beyond this limit are returned to the system.
+/// Blocks of at least `huge_page_size` are aligned to and advised to be backed
+/// by transparent huge pages, where supported.
+///
+/// Allocations smaller than `min_pooled_size` bypass the pool since the
+/// system allocator is efficient for these.
+class SCIPP_CORE_EXPORT MemoryPool {
+public:
+  static constexpr size_t alignment = 64;
+  static constexpr size_t min_pooled_size = size_t{1} << 12;
+  static constexpr size_t max_pooled_size = size_t{1} << 40;
+  static constexpr size_t huge_page_size = size_t{1} << 21;
+  static constexpr size_t n_size_class = 4 * 28;
+  static constexpr size_t slots_per_size_class = 8;
+  static constexpr scipp::index default_max_cached_bytes = scipp::index{1}
+                                                           << 30;
+
+  /// Return the index of the size class for an allocation of `size` bytes.
+  /// Must only be called for sizes in (min_pooled_size, max_pooled_size].
+  static constexpr size_t size_class(const size_t size) noexcept {
+    // Classes for sizes in (2^p, 2^(p+1)] are 2^p + k * 2^(p-2), k = 1..4.
+    const auto p = floor_log2(size - 1);
+    const auto step = size_t{1} << (p - 2);
+    const auto k = (size - (size_t{1} << p) + step - 1) / step;
+    return 4 * (p - min_pooled_log2) + k - 1;
   }
-  ~MemoryPool() {
-    for (auto &pools : m_pools) {
-      for (auto &pool : pools.second)
-        for (auto &ptr : pool)
-#ifdef _WIN32
-          _aligned_free(ptr);
-#else
-          free(ptr);
-#endif
-    }
+  /// Return the number of bytes of blocks in the given size class.
+  static constexpr size_t class_size(const size_t size_class) noexcept {
+    const auto p = size_class / 4 + min_pooled_log2;
+    const auto k = size_class % 4 + 1;
+    return (size_t{1} << p) + k * (size_t{1} << (p - 2));
   }
 
+  MemoryPool() = default;
+  MemoryPool(const MemoryPool &) = delete;
+  MemoryPool &operator=(const MemoryPool &) = delete;
+  ~MemoryPool() { release(); }
+
+  void *allocate(size_t size);
+  void deallocate(void *ptr, size_t size) noexcept;
+
+  [[nodiscard]] MemoryPoolStats stats() const noexcept;
+  [[nodiscard]] scipp::index max_cached_bytes() const noexcept;
+  /// Set the limit of cached bytes. Cached blocks exceeding the new limit are
+  /// returned to the system, starting with the largest size class.
+  void set_max_cached_bytes(scipp::index bytes);
+  /// Return all cached blocks, in the global free lists and in the caches of
+  /// all threads, to the system.
+  void release() noexcept;
+
 private:
-  mutable std::mutex m_mutex;
-  // Different pool for each size.
-  mutable std::map<size_t, std::array<std::vector<void *>, 2>> m_pools;
+  friend class MemoryPoolThreadCache;
+  static constexpr size_t min_pooled_log2 = 12;
+  static constexpr size_t floor_log2(size_t x) noexcept {
+    size_t log = 0;
+    while (x >>= 1)
+      ++log;
+    return log;
+  }
+
+  bool cache_global(void *ptr, size_t size_class) noexcept;
+  void free_block(void *ptr, size_t size_class) noexcept;
+  bool reserve_cache(size_t bytes) noexcept;
+  void *pop_global(size_t size_class) noexcept;
+  void *allocate_block(size_t size_class);
+  void trim(scipp::index bytes) noexcept;
+  void register_thread_cache(MemoryPoolThreadCache *cache);
+  void unregister_thread_cache(MemoryPoolThreadCache *cache) noexcept;
+
+  std::array<std::array<std::atomic<void *>, slots_per_size_class>,
+             n_size_class>
+      m_free{};
+  std::atomic<scipp::index> m_bytes_live{0};
+  std::atomic<scipp::index> m_bytes_cached{0};
+  std::atomic<scipp::index> m_hits{0};
+  std::atomic<scipp::index> m_misses{0};
+  std::atomic<scipp::index> m_max_cached_bytes{default_max_cached_bytes};
+  std::mutex m_thread_caches_mutex;
+  std::vector<MemoryPoolThreadCache *> m_thread_caches;
 };
 
-inline MemoryPool &instance() {
-  static MemoryPool pool;
-  return pool;
-}
+/// Return the process-wide memory pool.
+SCIPP_CORE_EXPORT MemoryPool &memory_pool();
 
 } // namespace scipp::core
@@ -5,12 +5,32 @@
 #pragma once
 
 #include <algorithm>
+#include <stdexcept>
 
 #include "scipp/common/index.h"
 
 /// Fallback wrappers without actual threading, in case TBB is not available.
 namespace scipp::core::parallel {
 
+constexpr scipp::index min_task_bytes = 32768;
+
+inline void set_max_threads(const scipp::index max_threads) {
+  if (max_threads < 0)
+    throw std::invalid_argument("Number of threads must not be negative.");
+}
+
+inline scipp::index max_concurrency() { return 1; }
+
+class ThreadLimit {
+public:
+  explicit ThreadLimit(const scipp::index max_threads) {
+    if (max_threads < 1)
+      throw std::invalid_argument("Number of threads must be positive.");
+  }
+};
+
+inline scipp::index default_ntask() { return 1; }
+
 class blocked_range {
 public:
   constexpr blocked_range(const scipp::index begin, const scipp::index end,
@@ -26,10 +46,25 @@ private:
   scipp::index m_end;
 };
 
+inline auto blocked_range_by_work(const scipp::index begin,
+                                  const scipp::index end,
+                                  const scipp::index bytes_per_item) {
+  static_cast<void>(bytes_per_item);
+  return blocked_range(begin, end);
+}
+
+struct static_partitioner {};
+
 template <class Op> void parallel_for(const blocked_range &range, Op &&op) {
   op(range);
 }
 
+template <class Op>
+void parallel_for(const blocked_range &range, Op &&op,
+                  const static_partitioner &) {
+  op(range);
+}
+
 template <class... Args> void parallel_sort(Args &&...args) {
   std::sort(std::forward<Args>(args)...);
 }
@@ -7,31 +7,107 @@
 #include <algorithm>
 #include <tbb/parallel_for.h>
 #include <tbb/parallel_sort.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_arena.h>
 
+#include "scipp-core_export.h"
 #include "scipp/common/index.h"
 
 /// Wrappers for multi-threading using TBB.
 namespace scipp::core::parallel {
 
+/// Minimum number of bytes a task should process to amortize the overhead of
+/// scheduling it.
+constexpr scipp::index min_task_bytes = 32768;
+
+/// Set the maximum number of threads used by scipp, or restore the default if
+/// `max_threads` is 0. Applies to all threads, including threads of other
+/// libraries that use TBB.
+SCIPP_CORE_EXPORT void set_max_threads(scipp::index max_threads);
+
+/// Return the number of threads available to parallel algorithms when called
+/// from the current thread, taking into account `set_max_threads` and any
+/// active ThreadLimit.
+[[nodiscard]] SCIPP_CORE_EXPORT scipp::index max_concurrency();
+
+/// Return the arena of the innermost ThreadLimit active on the current thread,
+/// or nullptr.
+[[nodiscard]] SCIPP_CORE_EXPORT tbb::task_arena *current_arena() noexcept;
+
+/// Limit the number of threads used by parallel algorithms called from the
+/// current thread while this object is alive.
+///
+/// In contrast to `set_max_threads` this does not affect other threads, e.g.,
+/// other tasks of a multi-threaded worker process. Instances must be destroyed
+/// on the thread that created them, in reverse order of creation.
+class SCIPP_CORE_EXPORT ThreadLimit {
+public:
+  explicit ThreadLimit(scipp::index max_threads);
+  ThreadLimit(const ThreadLimit &) = delete;
+  ThreadLimit &operator=(const ThreadLimit &) = delete;
+  ~ThreadLimit();
+
+private:
+  tbb::task_arena m_arena;
+  tbb::task_arena *m_previous;
+};
+
+/// Return the number of tasks to split a range into by default.
+///
+/// A few tasks per thread allow for load balancing. Smaller tasks are only
+/// created on demand by TBB's partitioner.
+inline scipp::index default_ntask() {
+  return std::max(scipp::index(24), 4 * max_concurrency());
+}
+
 inline auto blocked_range(const scipp::index begin, const scipp::index end,
                           const scipp::index grainsize = -1) {
   // TBB's default grain-size is 1, which is probably quite inefficient in
-  // some cases, in particular given the slow random-access of ViewIndex. A
-  // good default value is not known right now. In practice this should also
-  // depend heavily on whether we are processing small elements like `double`
-  // or something large like `event_list<double>`.
+  // some cases, in particular given the slow random-access of ViewIndex. If
+  // the cost per item is known `blocked_range_by_work` should be used instead.
   return tbb::blocked_range<scipp::index>(
       begin, end,
-      grainsize == -1 ? std::max(scipp::index(1), (end - begin) / 24)
-                      : grainsize);
+      grainsize == -1
+          ? std::max(scipp::index(1), (end - begin) / default_ntask())
+          : grainsize);
 }
 
-template <class... Args> void parallel_for(Args &&...args) {
-  tbb::parallel_for(std::forward<Args>(args)...);
+/// Return a range with grain-size based on the estimated number of bytes
+/// touched when processing a single item.
+///
+/// Small ranges result in a single task, i.e., no threading.
+inline auto blocked_range_by_work(const scipp::index begin,
+                                  const scipp::index end,
+                                  const scipp::index bytes_per_item) {
+  const auto bytes = std::max(scipp::index(1), bytes_per_item);
+  const auto min_grainsize = (min_task_bytes + bytes - 1) / bytes;
+  return blocked_range(
+      begin, end, std::max(min_grainsize, (end - begin) / default_ntask()));
+}
+
+/// Partitioner mapping equal parts of a range to threads without load
+/// balancing. Loops over the same range then touch the same memory from the
+/// same threads, i.e., pages are local to the NUMA node of the processing
+/// thread if they were first touched using the same partitioning.
+using static_partitioner = tbb::static_partitioner;
+
+template <class Range, class Op, class... Partitioner>
+void parallel_for(const Range &range, Op &&op,
+                  const Partitioner &...partitioner) {
+  // Avoid the overhead of the task scheduler if there is just a single task.
+  if (!range.is_divisible())
+    return op(range);
+  if (auto *arena = current_arena())
+    arena->execute([&]() { tbb::parallel_for(range, op, partitioner...); });
+  else
+    tbb::parallel_for(range, op, partitioner...);
 }
 
 template <class... Args> void parallel_sort(Args &&...args) {
-  tbb::parallel_sort(std::forward<Args>(args)...);
+  if (auto *arena = current_arena())
+    arena->execute([&]() { tbb::parallel_sort(args...); });
+  else
+    tbb::parallel_sort(std::forward<Args>(args)...);
 }
 
 } // namespace scipp::core::parallel
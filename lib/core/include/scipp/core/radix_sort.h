@@ -0,0 +1,211 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file LSD radix sort for numeric and time_point keys.
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "scipp/common/index.h"
+#include "scipp/core/parallel.h"
+#include "scipp/core/time_point.h"
+
+namespace scipp::core {
+
+namespace radix_detail {
+constexpr int digit_bits = 8;
+constexpr size_t nbucket = size_t{1} << digit_bits;
+/// Minimum number of elements per chunk that is processed by a single task.
+constexpr scipp::index min_chunk = 65536;
+using Histogram = std::array<scipp::index, nbucket>;
+
+template <class U> constexpr size_t digit(const U key, const int pass) {
+  return (key >> (pass * digit_bits)) & (nbucket - 1);
+}
+
+template <class U, class T> U bits(const T &x) {
+  static_assert(sizeof(U) == sizeof(T));
+  U u;
+  std::memcpy(&u, &x, sizeof(U));
+  return u;
+}
+} // namespace radix_detail
+
+/// Below this size comparison sorts are typically faster than radix sort.
+constexpr scipp::index radix_sort_min_size = 256;
+
+template <class T>
+constexpr bool is_radix_sortable_v =
+    std::is_same_v<T, double> || std::is_same_v<T, float> ||
+    std::is_same_v<T, int64_t> || std::is_same_v<T, int32_t> ||
+    std::is_same_v<T, time_point>;
+
+/// Unsigned integer type of the radix key of T.
+template <class T>
+using radix_key_t =
+    std::conditional_t<sizeof(T) == sizeof(uint32_t), uint32_t, uint64_t>;
+
+/// Return an unsigned key with the same order as `x`.
+///
+/// The order is that of `nan_sensitive_less`, i.e., all NaNs compare equal
+/// and greater than any other value, and -0.0 and 0.0 compare equal.
+template <class T> radix_key_t<T> radix_key(const T &x) {
+  using U = radix_key_t<T>;
+  constexpr U sign = U{1} << (8 * sizeof(U) - 1);
+  if constexpr (std::is_same_v<T, time_point>) {
+    return radix_key(x.time_since_epoch());
+  } else if constexpr (std::is_floating_point_v<T>) {
+    if (std::isnan(x))
+      return ~U{0};
+    const auto u = radix_detail::bits<U>(x == T{0} ? T{0} : x);
+    return (u & sign) ? ~u : (u | sign);
+  } else {
+    return radix_detail::bits<U>(x) ^ sign;
+  }
+}
+
+/// Stably sort `keys` of length `n` and permute the arrays `payloads` of the
+/// same length alongside.
+///
+/// This is a least-significant-digit radix sort with 8-bit digits. Digits
+/// that are identical for all keys are skipped, which is common for, e.g.,
+/// timestamps or small integers. For large arrays the histogram and scatter
+/// steps are processed in parallel chunks. Requires scratch space for a copy
+/// of keys and payloads.
+template <class U, class... Ts>
+void radix_sort(U *keys, const scipp::index n, Ts *...payloads) {
+  using namespace radix_detail;
+  constexpr int npass = sizeof(U);
+  const auto nchunk = std::clamp(n / min_chunk, scipp::index{1},
+                                 parallel::max_concurrency());
+  const auto chunk_begin = [n, nchunk](const scipp::index chunk) {
+    return n * chunk / nchunk;
+  };
+  // Histograms of all digits, used to find the passes that can be skipped.
+  std::vector<Histogram> counts(nchunk * npass, Histogram{});
+  parallel::parallel_for(
+      parallel::blocked_range(0, nchunk, 1), [&](const auto &range) {
+        for (auto c = range.begin(); c != range.end(); ++c)
+          for (auto i = chunk_begin(c); i < chunk_begin(c + 1); ++i)
+            for (int pass = 0; pass < npass; ++pass)
+              ++counts[c * npass + pass][digit(keys[i], pass)];
+      });
+
+  std::array<bool, npass> skip{};
+  for (int pass = 0; pass < npass; ++pass)
+    for (size_t b = 0; b < nbucket; ++b) {
+      scipp::index total = 0;
+      for (scipp::index c = 0; c < nchunk; ++c)
+        total += counts[c * npass + pass][b];
+      skip[pass] |= total == n;
+    }
+
+  std::vector<U> key_buffer(n);
+  std::tuple<std::vector<Ts>...> payload_buffers{std::vector<Ts>(n)...};
+  U *src = keys;
+  U *dst = key_buffer.data();
+  std::tuple<Ts *...> payload_src{payloads...};
+  auto payload_dst = std::apply(
+      [](auto &...buffers) { return std::tuple{buffers.data()...}; },
+      payload_buffers);
+  const auto move_payloads = [](const auto &in, const auto &out,
+                                const scipp::index from,
+                                const scipp::index to) {
+    std::apply(
+        [&](auto *...o) {
+          std::apply([&](const auto *...i) { ((o[to] = i[from]), ...); }, in);
+        },
+        out);
+  };
+  std::vector<Histogram> offsets(nchunk);
+  bool sorted_any = false;
+  for (int pass = 0; pass < npass; ++pass) {
+    if (skip[pass])
+      continue;
+    // Once keys have been reordered the histograms of chunks are outdated,
+    // unless there is only a single chunk.
+    if (sorted_any && nchunk > 1) {
+      parallel::parallel_for(
+          parallel::blocked_range(0, nchunk, 1), [&](const auto &range) {
+            for (auto c = range.begin(); c != range.end(); ++c) {
+              auto &hist = counts[c * npass + pass];
+              hist.fill(0);
+              for (auto i = chunk_begin(c); i < chunk_begin(c + 1); ++i)
+                ++hist[digit(src[i], pass)];
+            }
+          });
+    }
+    scipp::index offset = 0;
+    for (size_t b = 0; b < nbucket; ++b)
+      for (scipp::index c = 0; c < nchunk; ++c) {
+        offsets[c][b] = offset;
+        offset += counts[c * npass + pass][b];
+      }
+    parallel::parallel_for(
+        parallel::blocked_range(0, nchunk, 1), [&](const auto &range) {
+          for (auto c = range.begin(); c != range.end(); ++c) {
+            auto &chunk_offsets = offsets[c];
+            for (auto i = chunk_begin(c); i < chunk_begin(c + 1); ++i) {
+              const auto pos = chunk_offsets[digit(src[i], pass)]++;
+              dst[pos] = src[i];
+              move_payloads(payload_src, payload_dst, i, pos);
+            }
+          }
+        });
+    std::swap(src, dst);
+    std::swap(payload_src, payload_dst);
+    sorted_any = true;
+  }
+  if (src != keys) {
+    std::copy_n(src, n, keys);
+    const std::tuple<Ts *...> out{payloads...};
+    for (scipp::index i = 0; i < n; ++i)
+      move_payloads(payload_src, out, i, i);
+  }
+}
+
+/// Return the permutation that stably sorts `values`, in the order of
+/// `nan_sensitive_less` if `descending` is false, and the reverse otherwise.
+template <class Index, class T>
+std::vector<Index> radix_argsort(const T *values, const scipp::index n,
+                                 const bool descending) {
+  std::vector<radix_key_t<T>> keys(n);
+  std::vector<Index> perm(n);
+  parallel::parallel_for(
+      parallel::blocked_range_by_work(0, n, sizeof(T) + sizeof(Index)),
+      [&](const auto &range) {
+        for (auto i = range.begin(); i != range.end(); ++i) {
+          keys[i] = descending ? ~radix_key(values[i]) : radix_key(values[i]);
+          perm[i] = static_cast<Index>(i);
+        }
+      });
+  radix_sort(keys.data(), n, perm.data());
+  return perm;
+}
+
+/// Stably sort the `n` indices starting at `first` by `values[index]`, in
+/// ascending order of `radix_key`.
+///
+/// Runs on the calling thread unless `n` is very large, i.e., this is
+/// suitable for sorting many small ranges in parallel.
+template <class Index, class T>
+void sort_indices(Index *first, const scipp::index n, const T *values) {
+  if (n >= radix_sort_min_size) {
+    std::vector<radix_key_t<T>> keys(n);
+    for (scipp::index i = 0; i < n; ++i)
+      keys[i] = radix_key(values[first[i]]);
+    radix_sort(keys.data(), n, first);
+  } else {
+    std::stable_sort(first, first + n, [values](const Index a, const Index b) {
+      return radix_key(values[a]) < radix_key(values[b]);
+    });
+  }
+}
+
+} // namespace scipp::core
@@ -0,0 +1,195 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+
+#include <boost/container/small_vector.hpp>
+
+#include "scipp/common/index.h"
+#include "scipp/core/element_array_view.h"
+#include "scipp/core/parallel.h"
+
+namespace scipp::core {
+
+namespace strided_copy_detail {
+struct Axis {
+  scipp::index size;
+  scipp::index src_stride;
+  scipp::index dst_stride;
+};
+using Axes = boost::container::small_vector<Axis, NDIM_STACK>;
+
+/// Return the axes of the copy, ordered from outermost to innermost.
+///
+/// Axes of length 1 are dropped and neighboring axes that are contiguous in
+/// both source and destination are merged, such that, e.g., a copy of a
+/// contiguous slice of an array has a single long axis.
+inline Axes make_axes(const Dimensions &dims, const Strides &src,
+                      const Strides &dst) {
+  Axes axes;
+  for (scipp::index i = 0; i < dims.ndim(); ++i) {
+    Axis axis{dims.size(i), src[i], dst[i]};
+    if (axis.size == 1)
+      continue;
+    if (!axes.empty()) {
+      const auto &outer = axes.back();
+      if (outer.src_stride == axis.src_stride * axis.size &&
+          outer.dst_stride == axis.dst_stride * axis.size) {
+        axes.back() = {outer.size * axis.size, axis.src_stride,
+                       axis.dst_stride};
+        continue;
+      }
+    }
+    axes.push_back(axis);
+  }
+  return axes;
+}
+
+/// Iterate over the `n` outer axes of `axes` in row-major order, calling `f`
+/// with the source and destination offsets of the rows in [begin, end).
+template <class F>
+void for_each_row(const Axes &axes, const scipp::index n,
+                  const scipp::index begin, const scipp::index end, F &&f) {
+  boost::container::small_vector<scipp::index, NDIM_STACK> pos(n);
+  scipp::index src = 0;
+  scipp::index dst = 0;
+  for (scipp::index i = n - 1, remainder = begin; i >= 0; --i) {
+    pos[i] = remainder % axes[i].size;
+    remainder /= axes[i].size;
+    src += pos[i] * axes[i].src_stride;
+    dst += pos[i] * axes[i].dst_stride;
+  }
+  for (scipp::index row = begin; row < end; ++row) {
+    f(src, dst);
+    for (scipp::index i = n - 1; i >= 0; --i) {
+      src += axes[i].src_stride;
+      dst += axes[i].dst_stride;
+      if (++pos[i] < axes[i].size)
+        break;
+      src -= axes[i].size * axes[i].src_stride;
+      dst -= axes[i].size * axes[i].dst_stride;
+      pos[i] = 0;
+    }
+  }
+}
+
+/// Edge length of tiles in transposing copies, chosen such that a tile of
+/// source and destination fits into L1 cache.
+template <class T>
+constexpr scipp::index transpose_tile =
+    std::clamp<scipp::index>(128 / sizeof(T), 8, 32);
+
+template <class T>
+void copy_rows(const T *src, T *dst, const Axes &axes) {
+  const auto inner = axes.back();
+  const auto nouter = static_cast<scipp::index>(axes.size()) - 1;
+  scipp::index nrow = 1;
+  for (scipp::index i = 0; i < nouter; ++i)
+    nrow *= axes[i].size;
+  const auto contiguous = inner.src_stride == 1 && inner.dst_stride == 1;
+  parallel::parallel_for(
+      parallel::blocked_range_by_work(0, nrow, 2 * sizeof(T) * inner.size),
+      [&](const auto &range) {
+        for_each_row(axes, nouter, range.begin(), range.end(),
+                     [&](const scipp::index s, const scipp::index d) {
+                       if (contiguous) {
+                         std::memcpy(dst + d, src + s, sizeof(T) * inner.size);
+                       } else {
+                         for (scipp::index i = 0; i < inner.size; ++i)
+                           dst[d + i * inner.dst_stride] =
+                               src[s + i * inner.src_stride];
+                       }
+                     });
+      },
+      parallel::static_partitioner{});
+}
+
+/// Copy where the two innermost axes are swapped between source and
+/// destination, processed in square tiles for cache locality.
+template <class T>
+void copy_transposed(const T *src, T *dst, const Axes &axes) {
+  constexpr auto tile = transpose_tile<T>;
+  const auto nouter = static_cast<scipp::index>(axes.size()) - 2;
+  const auto rows = axes[nouter];
+  const auto cols = axes[nouter + 1];
+  const auto nrow_tile = (rows.size + tile - 1) / tile;
+  scipp::index ntask = nrow_tile;
+  for (scipp::index i = 0; i < nouter; ++i)
+    ntask *= axes[i].size;
+  parallel::parallel_for(
+      parallel::blocked_range_by_work(0, ntask,
+                                      2 * sizeof(T) * tile * cols.size),
+      [&](const auto &range) {
+        // Outer rows are visited in units of row tiles.
+        const auto begin = range.begin() / nrow_tile;
+        const auto end = (range.end() + nrow_tile - 1) / nrow_tile;
+        scipp::index task = begin * nrow_tile;
+        for_each_row(
+            axes, nouter, begin, end,
+            [&](const scipp::index s, const scipp::index d) {
+              for (scipp::index t = 0; t < nrow_tile; ++t, ++task) {
+                if (task < range.begin() || task >= range.end())
+                  continue;
+                const auto i0 = t * tile;
+                const auto i1 = std::min(i0 + tile, rows.size);
+                for (scipp::index j0 = 0; j0 < cols.size; j0 += tile) {
+                  const auto j1 = std::min(j0 + tile, cols.size);
+                  for (scipp::index i = i0; i < i1; ++i)
+                    for (scipp::index j = j0; j < j1; ++j)
+                      dst[d + i * rows.dst_stride + j] =
+                          src[s + i + j * cols.src_stride];
+                }
+              }
+            });
+      },
+      parallel::static_partitioner{});
+}
+} // namespace strided_copy_detail
+
+/// Return true if strided_copy can copy between views with these layouts.
+///
+/// This requires plain (non-binned) views over distinct memory and no
+/// broadcast in the destination.
+template <class T>
+bool can_strided_copy(const ElementArrayView<const T> &src,
+                      const ElementArrayView<T> &dst) {
+  if (src.bucketParams() || dst.bucketParams() || src.dims() != dst.dims())
+    return false;
+  if (dst.dims().volume() == 0)
+    return true;
+  for (scipp::index i = 0; i < dst.dims().ndim(); ++i)
+    if (dst.strides()[i] == 0 && dst.dims().size(i) != 1)
+      return false;
+  return !dst.overlaps(src);
+}
+
+/// Copy elements of `src` to `dst`, which must have identical dims.
+///
+/// In contrast to an element-wise loop using a MultiIndex this merges
+/// contiguous axes, copies contiguous rows with memcpy, uses tiles when
+/// transposing the two innermost axes, and parallelizes over rows or tiles.
+/// Use `can_strided_copy` to check whether the views are supported.
+template <class T>
+void strided_copy(const ElementArrayView<const T> &src,
+                  ElementArrayView<T> dst) {
+  static_assert(std::is_trivially_copyable_v<T>);
+  using namespace strided_copy_detail;
+  if (dst.dims().volume() == 0)
+    return;
+  const auto axes = make_axes(dst.dims(), src.strides(), dst.strides());
+  if (axes.empty()) {
+    *dst.data() = *src.data();
+  } else if (axes.size() >= 2 && axes.back().dst_stride == 1 &&
+             axes.back().src_stride != 1 &&
+             axes[axes.size() - 2].src_stride == 1) {
+    copy_transposed(src.data(), dst.data(), axes);
+  } else {
+    copy_rows(src.data(), dst.data(), axes);
+  }
+}
+
+} // namespace scipp::core
@@ -0,0 +1,296 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+#include "scipp/core/memory_pool.h"
+
+namespace scipp::core {
+
+namespace {
+#ifdef _WIN32
+// https://stackoverflow.com/questions/33696092/whats-the-correct-replacement-for-posix-memalign-in-windows
+int check_align(size_t align) {
+  for (size_t i = sizeof(void *); i != 0; i *= 2)
+    if (align == i)
+      return 0;
+  return EINVAL;
+}
+
+int posix_memalign(void **ptr, size_t align, size_t size) {
+  if (check_align(align))
+    return EINVAL;
+
+  int saved_errno = errno;
+  void *p = _aligned_malloc(size, align);
+  if (p == NULL) {
+    errno = saved_errno;
+    return ENOMEM;
+  }
+
+  *ptr = p;
+  return 0;
+}
+#endif
+
+void *system_allocate(const size_t align, const size_t size) {
+  void *ptr = nullptr;
+  if (posix_memalign(&ptr, align, size) != 0)
+    throw std::bad_alloc();
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  if (size >= MemoryPool::huge_page_size)
+    madvise(ptr, size, MADV_HUGEPAGE); // Only a hint, ignore failure.
+#endif
+  return ptr;
+}
+
+void system_deallocate(void *ptr) noexcept {
+#ifdef _WIN32
+  _aligned_free(ptr);
+#else
+  free(ptr);
+#endif
+}
+
+size_t block_alignment(const size_t size) noexcept {
+  return size >= MemoryPool::huge_page_size ? MemoryPool::huge_page_size
+                                            : MemoryPool::alignment;
+}
+
+bool is_pooled(const size_t size) noexcept {
+  return size > MemoryPool::min_pooled_size &&
+         size <= MemoryPool::max_pooled_size;
+}
+
+static_assert(MemoryPool::max_pooled_size ==
+              MemoryPool::class_size(MemoryPool::n_size_class - 1));
+
+// Set when the cache of the current thread has been destroyed, blocks freed
+// by destructors of other thread-local objects then bypass the cache.
+thread_local bool thread_cache_destroyed = false;
+} // namespace
+
+/// Per-thread cache of freed blocks, avoiding contention on the global free
+/// lists for the common case of allocating and freeing in the same thread.
+///
+/// Only the owning thread puts blocks into the slots, but any thread may take
+/// them out, so `MemoryPool::release` can drain the caches of all threads.
+/// Caches are registered with the pool for that purpose.
+class MemoryPoolThreadCache {
+public:
+  static constexpr size_t slots = 2;
+
+  explicit MemoryPoolThreadCache(MemoryPool &pool) : m_pool(pool) {
+    m_pool.register_thread_cache(this);
+  }
+  MemoryPoolThreadCache(const MemoryPoolThreadCache &) = delete;
+  MemoryPoolThreadCache &operator=(const MemoryPoolThreadCache &) = delete;
+  ~MemoryPoolThreadCache() {
+    thread_cache_destroyed = true;
+    m_pool.unregister_thread_cache(this);
+    release();
+  }
+
+  void *pop(const size_t size_class) noexcept {
+    for (auto &slot : m_blocks[size_class])
+      if (slot.load(std::memory_order_relaxed) != nullptr)
+        if (auto *ptr = slot.exchange(nullptr, std::memory_order_acquire))
+          return ptr;
+    return nullptr;
+  }
+
+  /// Put a block into a free slot. Must only be called by the owning thread.
+  bool push(void *ptr, const size_t size_class) noexcept {
+    for (auto &slot : m_blocks[size_class])
+      if (slot.load(std::memory_order_relaxed) == nullptr) {
+        slot.store(ptr, std::memory_order_release);
+        return true;
+      }
+    return false;
+  }
+
+  /// Move cached blocks to the global free lists or return them to the system.
+  void release() noexcept {
+    for (size_t size_class = 0; size_class < m_blocks.size(); ++size_class)
+      while (auto *ptr = pop(size_class))
+        if (!m_pool.cache_global(ptr, size_class))
+          m_pool.free_block(ptr, size_class);
+  }
+
+private:
+  MemoryPool &m_pool;
+  std::array<std::array<std::atomic<void *>, slots>, MemoryPool::n_size_class>
+      m_blocks{};
+};
+
+namespace {
+/// Return the cache of the calling thread, only the process-wide pool uses
+/// thread caches.
+MemoryPoolThreadCache *thread_cache(const MemoryPool &pool) {
+  if (thread_cache_destroyed || &pool != &memory_pool())
+    return nullptr;
+  thread_local MemoryPoolThreadCache cache(memory_pool());
+  return &cache;
+}
+} // namespace
+
+void *MemoryPool::allocate(const size_t size) {
+  if (size == 0)
+    return nullptr;
+  if (!is_pooled(size)) {
+    auto *ptr = system_allocate(alignment, size);
+    m_bytes_live += static_cast<scipp::index>(size);
+    return ptr;
+  }
+  const auto cls = size_class(size);
+  const auto bytes = static_cast<scipp::index>(class_size(cls));
+  auto *cache = thread_cache(*this);
+  void *ptr = cache ? cache->pop(cls) : nullptr;
+  if (!ptr)
+    ptr = pop_global(cls);
+  if (ptr) {
+    m_bytes_cached -= bytes;
+    ++m_hits;
+  } else {
+    ptr = allocate_block(cls);
+    ++m_misses;
+  }
+  m_bytes_live += bytes;
+  return ptr;
+}
+
+void MemoryPool::deallocate(void *ptr, const size_t size) noexcept {
+  if (!ptr)
+    return;
+  if (!is_pooled(size)) {
+    m_bytes_live -= static_cast<scipp::index>(size);
+    return system_deallocate(ptr);
+  }
+  const auto cls = size_class(size);
+  m_bytes_live -= static_cast<scipp::index>(class_size(cls));
+  if (!reserve_cache(class_size(cls)))
+    return system_deallocate(ptr);
+  auto *cache = thread_cache(*this);
+  if (!(cache && cache->push(ptr, cls)) && !cache_global(ptr, cls))
+    free_block(ptr, cls);
+}
+
+MemoryPoolStats MemoryPool::stats() const noexcept {
+  return {m_bytes_live, m_bytes_cached, m_hits, m_misses};
+}
+
+scipp::index MemoryPool::max_cached_bytes() const noexcept {
+  return m_max_cached_bytes;
+}
+
+void MemoryPool::set_max_cached_bytes(const scipp::index bytes) {
+  if (bytes < 0)
+    throw std::invalid_argument("Memory pool limit must not be negative.");
+  m_max_cached_bytes = bytes;
+  if (m_bytes_cached > bytes)
+    trim(bytes);
+}
+
+void MemoryPool::release() noexcept { trim(0); }
+
+/// Return cached blocks to the system until at most `bytes` are cached.
+///
+/// Blocks are taken from the global free lists and from the caches of all
+/// threads, starting with the largest size class.
+void MemoryPool::trim(const scipp::index bytes) noexcept {
+  const std::lock_guard lock(m_thread_caches_mutex);
+  const auto free_all = [&](const size_t cls, const auto &pop) {
+    while (m_bytes_cached > bytes)
+      if (auto *ptr = pop(cls))
+        free_block(ptr, cls);
+      else
+        return;
+  };
+  for (size_t cls = n_size_class; cls-- > 0 && m_bytes_cached > bytes;) {
+    free_all(cls, [this](const size_t c) { return pop_global(c); });
+    for (auto *cache : m_thread_caches)
+      free_all(cls, [cache](const size_t c) { return cache->pop(c); });
+  }
+}
+
+void MemoryPool::register_thread_cache(MemoryPoolThreadCache *cache) {
+  const std::lock_guard lock(m_thread_caches_mutex);
+  m_thread_caches.push_back(cache);
+}
+
+void MemoryPool::unregister_thread_cache(
+    MemoryPoolThreadCache *cache) noexcept {
+  const std::lock_guard lock(m_thread_caches_mutex);
+  m_thread_caches.erase(
+      std::find(m_thread_caches.begin(), m_thread_caches.end(), cache));
+}
+
+/// Try to account for `bytes` additional cached bytes, fails if this would
+/// exceed the limit.
+bool MemoryPool::reserve_cache(const size_t bytes) noexcept {
+  const auto n = static_cast<scipp::index>(bytes);
+  if (m_bytes_cached.fetch_add(n) + n <= m_max_cached_bytes)
+    return true;
+  m_bytes_cached -= n;
+  return false;
+}
+
+/// Put a block (already accounted for as cached) into a global free list slot.
+///
+/// Each slot is claimed by a single compare-exchange, so the free lists are
+/// lock-free and, since a block is never read while it is in a slot, there are
+/// no ABA issues or accesses to memory freed by other threads.
+bool MemoryPool::cache_global(void *ptr, const size_t size_class) noexcept {
+  for (auto &slot : m_free[size_class]) {
+    void *expected = nullptr;
+    if (slot.load(std::memory_order_relaxed) == nullptr &&
+        slot.compare_exchange_strong(expected, ptr, std::memory_order_release,
+                                     std::memory_order_relaxed))
+      return true;
+  }
+  return false;
+}
+
+void *MemoryPool::pop_global(const size_t size_class) noexcept {
+  for (auto &slot : m_free[size_class])
+    if (slot.load(std::memory_order_relaxed) != nullptr)
+      if (auto *ptr = slot.exchange(nullptr, std::memory_order_acquire))
+        return ptr;
+  return nullptr;
+}
+
+/// Return a cached block to the system.
+void MemoryPool::free_block(void *ptr, const size_t size_class) noexcept {
+  m_bytes_cached -= static_cast<scipp::index>(class_size(size_class));
+  system_deallocate(ptr);
+}
+
+void *MemoryPool::allocate_block(const size_t size_class) {
+  const auto size = class_size(size_class);
+  try {
+    return system_allocate(block_alignment(size), size);
+  } catch (std::bad_alloc &) {
+    // Cached blocks of other size classes may prevent the allocation.
+    release();
+    return system_allocate(block_alignment(size), size);
+  }
+}
+
+MemoryPool &memory_pool() {
+  // Intentionally leaked: Per-thread caches may be flushed when threads exit
+  // after static destructors have run.
+  static auto *pool = new MemoryPool();
+  return *pool;
+}
+
+} // namespace scipp::core
@@ -0,0 +1,55 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+
+#include <tbb/global_control.h>
+
+#include "scipp/core/parallel.h"
+
+namespace scipp::core::parallel {
+
+namespace {
+std::mutex global_limit_mutex;
+std::unique_ptr<tbb::global_control> global_limit;
+thread_local tbb::task_arena *innermost_arena = nullptr;
+
+int checked_thread_count(const scipp::index max_threads) {
+  if (max_threads < 1)
+    throw std::invalid_argument("Number of threads must be positive.");
+  return static_cast<int>(max_threads);
+}
+} // namespace
+
+void set_max_threads(const scipp::index max_threads) {
+  if (max_threads < 0)
+    throw std::invalid_argument("Number of threads must not be negative.");
+  std::lock_guard lock(global_limit_mutex);
+  global_limit.reset();
+  if (max_threads > 0)
+    global_limit = std::make_unique<tbb::global_control>(
+        tbb::global_control::max_allowed_parallelism, max_threads);
+}
+
+scipp::index max_concurrency() {
+  const scipp::index global = tbb::global_control::active_value(
+      tbb::global_control::max_allowed_parallelism);
+  if (const auto *arena = current_arena())
+    return std::min(global, scipp::index(arena->max_concurrency()));
+  return std::min(global,
+                  scipp::index(tbb::this_task_arena::max_concurrency()));
+}
+
+tbb::task_arena *current_arena() noexcept { return innermost_arena; }
+
+ThreadLimit::ThreadLimit(const scipp::index max_threads)
+    : m_arena(checked_thread_count(max_threads)),
+      m_previous(innermost_arena) {
+  innermost_arena = &m_arena;
+}
+
+ThreadLimit::~ThreadLimit() { innermost_arena = m_previous; }
+
+} // namespace scipp::core::parallel
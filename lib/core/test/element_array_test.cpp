@@ -3,11 +3,13 @@
 #include <gtest/gtest.h>
 
 #include <array>
+#include <memory>
 #include <vector>
 
 #include "scipp/core/element_array.h"
 
 using scipp::core::element_array;
+using scipp::core::borrow;
 using scipp::core::init_for_overwrite;
 
 static auto make_element_array() {
@@ -180,3 +182,45 @@ TEST(ElementArrayTest, resize_default_init) {
   x.resize(0, init_for_overwrite);
   check_empty_element_array(x);
 }
+
+TEST(ElementArrayTest, borrow) {
+  std::vector<double> buffer{1.0, 2.0, 3.0};
+  auto owner = std::make_shared<int>(0);
+  {
+    element_array<double> x(buffer.data(), 3, owner, borrow);
+    ASSERT_TRUE(x.is_borrowed());
+    ASSERT_EQ(x.data(), buffer.data());
+    ASSERT_EQ(owner.use_count(), 2);
+    x.data()[1] = 4.0;
+    ASSERT_EQ(buffer[1], 4.0);
+  }
+  ASSERT_EQ(owner.use_count(), 1);
+}
+
+TEST(ElementArrayTest, borrow_requires_owner) {
+  std::vector<double> buffer{1.0, 2.0};
+  EXPECT_THROW(
+      element_array<double>(buffer.data(), 2, nullptr, borrow),
+      std::invalid_argument);
+}
+
+TEST(ElementArrayTest, borrow_copy_is_owned) {
+  std::vector<double> buffer{1.0, 2.0};
+  auto owner = std::make_shared<int>(0);
+  element_array<double> x(buffer.data(), 2, owner, borrow);
+  const auto copy(x);
+  ASSERT_FALSE(copy.is_borrowed());
+  ASSERT_NE(copy.data(), buffer.data());
+  ASSERT_EQ(copy.data()[1], 2.0);
+  ASSERT_EQ(owner.use_count(), 2);
+}
+
+TEST(ElementArrayTest, borrow_resize_detaches) {
+  std::vector<double> buffer{1.0, 2.0};
+  auto owner = std::make_shared<int>(0);
+  element_array<double> x(buffer.data(), 2, owner, borrow);
+  x.resize(2, init_for_overwrite);
+  ASSERT_FALSE(x.is_borrowed());
+  ASSERT_NE(x.data(), buffer.data());
+  ASSERT_EQ(owner.use_count(), 1);
+}
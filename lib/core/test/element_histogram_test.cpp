@@ -65,3 +65,56 @@ TEST(ElementHistogramTest, no_variance) {
                      edges);
   EXPECT_EQ(result_vals, std::vector<double>({20 + 30, 40 + 50}));
 }
+
+namespace {
+template <class Data>
+void histogram_many_events(const Data &data, const bool linspace) {
+  // Enough events to be split into several chunks.
+  const scipp::index nevent = 1000000;
+  std::vector<double> edges{0, 1, 2, 3, 4};
+  if (!linspace)
+    edges.back() = 5;
+  std::vector<double> events(nevent);
+  std::vector<double> weights(nevent);
+  for (scipp::index i = 0; i < nevent; ++i) {
+    events[i] = static_cast<double>(i % 7) * 0.75 - 0.5;
+    weights[i] = static_cast<double>(i % 3);
+  }
+  std::vector<double> expected(4, 0.0);
+  for (scipp::index i = 0; i < nevent; ++i) {
+    const auto it = std::upper_bound(edges.begin(), edges.end(), events[i]);
+    if (it != edges.begin() && it != edges.end())
+      expected[std::distance(edges.begin(), it) - 1] += weights[i];
+  }
+  if constexpr (is_ValueAndVariance_v<Data>) {
+    element::histogram(data, events,
+                       ValueAndVariance(scipp::span(weights),
+                                        scipp::span(weights)),
+                       edges);
+    EXPECT_TRUE(std::equal(data.value.begin(), data.value.end(),
+                           expected.begin()));
+    EXPECT_TRUE(std::equal(data.variance.begin(), data.variance.end(),
+                           expected.begin()));
+  } else {
+    element::histogram(data, events, weights, edges);
+    EXPECT_TRUE(std::equal(data.begin(), data.end(), expected.begin()));
+  }
+}
+} // namespace
+
+TEST(ElementHistogramTest, many_events_linspace) {
+  std::vector<double> result(4, 1.0);
+  histogram_many_events(scipp::span(result), true);
+}
+
+TEST(ElementHistogramTest, many_events_sorted) {
+  std::vector<double> result(4, 1.0);
+  histogram_many_events(scipp::span(result), false);
+}
+
+TEST(ElementHistogramTest, many_events_with_variances) {
+  std::vector<double> vals(4, 1.0);
+  std::vector<double> vars(4, 1.0);
+  histogram_many_events(ValueAndVariance(scipp::span(vals), scipp::span(vars)),
+                        true);
+}
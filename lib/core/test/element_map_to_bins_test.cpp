@@ -49,6 +49,35 @@ TEST_F(ElementMapToBinsTest, data_matching_index_equivalent_to_sort) {
   EXPECT_EQ(binned, data) << seed;
 }
 
+TEST_F(ElementMapToBinsTest, chunkwise_reuses_buffers) {
+  auto bins2 = bins;
+  map_to_bins_chunkwise<4>(binned, bins, data, bin_indices);
+  const auto &buffers = map_to_bins_detail::chunk_buffers<double, int16_t>(1);
+  EXPECT_GT(std::get<0>(buffers.front()).capacity(), 0);
+  auto binned2 = binned;
+  map_to_bins_chunkwise<4>(binned2, bins2, data, bin_indices);
+  EXPECT_EQ(binned, binned2) << seed;
+  std::sort(data.begin(), data.end());
+  EXPECT_EQ(binned2, data) << seed;
+}
+
+TEST(ElementMapToBinsChunkwiseTest, frees_large_buffers) {
+  // Many bins, such that a single block exceeds the retained capacity.
+  const scipp::index nbin = 65536;
+  std::vector<scipp::index> bin_indices(2 * nbin);
+  for (scipp::index i = 0; i < scipp::size(bin_indices); ++i)
+    bin_indices[i] = i % nbin;
+  std::vector<double> data(bin_indices.begin(), bin_indices.end());
+  std::vector<scipp::index> bins(nbin);
+  for (scipp::index i = 0; i < nbin; ++i)
+    bins[i] = 2 * i;
+  std::vector<double> binned(data.size());
+  map_to_bins_chunkwise<64>(binned, bins, data, bin_indices);
+  EXPECT_TRUE((map_to_bins_detail::chunk_buffers<double, int16_t>(0).empty()));
+  std::sort(data.begin(), data.end());
+  EXPECT_EQ(binned, data);
+}
+
 class ElementMapToBinsChunkedTest
     : public ElementMapToBinsTest,
       public ::testing::WithParamInterface<
@@ -85,3 +114,25 @@ TEST_P(ElementMapToBinsChunkedTest, direct_equivalent_to_chunkwise) {
   check_direct_equivalent_to_chunkwise<1024>();
   check_direct_equivalent_to_chunkwise<2048>();
 }
+
+TEST_P(ElementMapToBinsChunkedTest, direct_equivalent_to_parallel) {
+  for (const scipp::index nchunk : {2, 3, 7}) {
+    auto binned1 = binned;
+    auto binned2 = binned;
+    auto bins1 = bins;
+    auto bins2 = bins;
+    map_to_bins_direct(binned1, bins1, data, bin_indices);
+    scipp::span<double> out(binned2);
+    map_to_bins_parallel(out, bins2, scipp::span<const double>(data),
+                         scipp::span<const scipp::index>(bin_indices), nchunk);
+    EXPECT_EQ(binned1, binned2) << seed;
+    EXPECT_EQ(bins1, bins2) << seed;
+  }
+}
+
+TEST(ElementMapToBinsParallelTest, nchunk) {
+  EXPECT_EQ(map_to_bins_nchunk(1000, 10), 0);
+  EXPECT_EQ(map_to_bins_nchunk(1000000, 10), 15);
+  EXPECT_EQ(map_to_bins_nchunk(1000000000, 10), 24);
+  EXPECT_EQ(map_to_bins_nchunk(1000000, 100000), 1);
+}
@@ -0,0 +1,58 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "scipp/core/gather.h"
+
+using namespace scipp;
+using namespace scipp::core;
+
+TEST(GatherTest, inner_1) {
+  const std::vector<double> src{1, 2, 3, 4, 5, 6};
+  const std::vector<int32_t> indices{2, 0, 0};
+  std::vector<double> dst(6);
+  // Shape (2, 3, 1) gathered to (2, 3, 1).
+  gather(src.data(), dst.data(), indices.data(), 3, 3, 2, 1);
+  EXPECT_EQ(dst, std::vector<double>({3, 1, 1, 6, 4, 4}));
+}
+
+TEST(GatherTest, inner_rows) {
+  const std::vector<std::string> src{"a", "b", "c", "d", "e", "f"};
+  const std::vector<int64_t> indices{2, 1};
+  std::vector<std::string> dst(4);
+  // Shape (1, 3, 2) gathered to (1, 2, 2).
+  gather(src.data(), dst.data(), indices.data(), 2, 3, 1, 2);
+  EXPECT_EQ(dst, std::vector<std::string>({"e", "f", "c", "d"}));
+}
+
+TEST(GatherTest, multiple_index_blocks) {
+  const scipp::index size = 3 * gather_detail::index_block + 7;
+  std::vector<int64_t> src(2 * size);
+  std::iota(src.begin(), src.end(), 0);
+  std::vector<int64_t> indices(size);
+  std::iota(indices.rbegin(), indices.rend(), 0);
+  std::vector<int64_t> dst(2 * size);
+  gather(src.data(), dst.data(), indices.data(), size, size, 2, 1);
+  for (scipp::index o = 0; o < 2; ++o)
+    for (scipp::index i = 0; i < size; ++i)
+      ASSERT_EQ(dst[o * size + i], o * size + size - 1 - i);
+}
+
+TEST(GatherTest, argsort) {
+  const std::vector<double> key{3, 1, 2, 1};
+  const auto get = [&key](const scipp::index i) { return key[i]; };
+  EXPECT_EQ(argsort<int64_t>(4, get, std::less<>{}),
+            std::vector<int64_t>({1, 3, 2, 0}));
+  // Ties are kept in input order.
+  EXPECT_EQ(argsort<int32_t>(4, get, std::greater<>{}),
+            std::vector<int32_t>({0, 2, 1, 3}));
+}
+
+TEST(GatherTest, argsort_empty) {
+  const auto get = [](const scipp::index) { return 0; };
+  EXPECT_TRUE(argsort<int64_t>(0, get, std::less<>{}).empty());
+}
@@ -0,0 +1,134 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "scipp/core/histogram.h"
+
+using namespace scipp;
+using namespace scipp::core;
+
+namespace {
+template <class Edges, class T>
+scipp::index std_upper_bound(const Edges &edges, const T &x) {
+  return std::upper_bound(edges.begin(), edges.end(), x) - edges.begin();
+}
+
+template <class T> void check_all(const std::vector<T> &edges) {
+  const SortedEdgeIndex<T> index(edges);
+  std::vector<T> points(edges);
+  for (const auto &edge : edges) {
+    points.push_back(std::nextafter(edge, -std::numeric_limits<T>::infinity()));
+    points.push_back(std::nextafter(edge, std::numeric_limits<T>::infinity()));
+  }
+  points.push_back(-std::numeric_limits<T>::infinity());
+  points.push_back(std::numeric_limits<T>::infinity());
+  points.push_back(std::numeric_limits<T>::quiet_NaN());
+  points.push_back(T{0});
+  points.push_back(-T{0});
+  points.push_back(T{-1});
+  for (const auto x : points) {
+    EXPECT_EQ(upper_bound_index(edges, x), std_upper_bound(edges, x)) << x;
+    EXPECT_EQ(index.upper_bound(x), std_upper_bound(edges, x)) << x;
+  }
+}
+} // namespace
+
+TEST(HistogramTest, upper_bound_index_empty) {
+  const std::vector<double> edges;
+  EXPECT_EQ(upper_bound_index(edges, 1.0), 0);
+  EXPECT_EQ(SortedEdgeIndex<double>(edges).upper_bound(1.0), 0);
+}
+
+TEST(HistogramTest, upper_bound_index_duplicate_edges) {
+  const std::vector<int64_t> edges{1, 2, 2, 2, 5, 5, 9};
+  const SortedEdgeIndex<int64_t> index(edges);
+  for (int64_t x = -1; x < 11; ++x) {
+    EXPECT_EQ(upper_bound_index(edges, x), std_upper_bound(edges, x));
+    EXPECT_EQ(index.upper_bound(x), std_upper_bound(edges, x));
+  }
+}
+
+TEST(HistogramTest, upper_bound_index_mixed_types) {
+  const std::vector<double> edges{-1.5, 0.0, 2.5, 10.0};
+  const SortedEdgeIndex<double> index(edges);
+  for (int32_t x = -3; x < 12; ++x) {
+    EXPECT_EQ(upper_bound_index(edges, x), std_upper_bound(edges, x));
+    EXPECT_EQ(index.upper_bound(x), std_upper_bound(edges, x));
+  }
+}
+
+TEST(HistogramTest, sorted_edge_index_int64_values_int32_edges) {
+  const std::vector<int32_t> edges{-7, 0, 3, 1000,
+                                   std::numeric_limits<int32_t>::max()};
+  const SortedEdgeIndex<int32_t> index(edges);
+  constexpr int64_t wrap = int64_t{1} << 32;
+  for (const int64_t x :
+       {int64_t{-8}, int64_t{-7}, int64_t{2}, int64_t{1000}, wrap + 1,
+        wrap - 1, -wrap + 1, int64_t{std::numeric_limits<int32_t>::max()} + 1,
+        int64_t{std::numeric_limits<int32_t>::min()} - 1,
+        std::numeric_limits<int64_t>::max(),
+        std::numeric_limits<int64_t>::min()}) {
+    EXPECT_EQ(index.upper_bound(x), std_upper_bound(edges, x)) << x;
+  }
+}
+
+TEST(HistogramTest, sorted_edge_index_double_values_float_edges) {
+  std::vector<float> edges(100);
+  for (size_t i = 0; i < edges.size(); ++i)
+    edges[i] = std::pow(10.0f, -2.0f + 0.05f * static_cast<float>(i));
+  const SortedEdgeIndex<float> index(edges);
+  EXPECT_TRUE(index.is_log());
+  std::vector<double> points{-1.0, 0.0, 1e300, -1e300,
+                             std::numeric_limits<double>::infinity(),
+                             std::numeric_limits<double>::quiet_NaN()};
+  for (const auto edge : edges) {
+    // Values that round to the edge when converted to float.
+    points.push_back(std::nextafter(static_cast<double>(edge), 0.0));
+    points.push_back(std::nextafter(static_cast<double>(edge), 1e300));
+  }
+  for (const auto x : points)
+    EXPECT_EQ(index.upper_bound(x), std_upper_bound(edges, x)) << x;
+}
+
+TEST(HistogramTest, sorted_edge_index_time_point) {
+  const std::vector<time_point> edges{time_point{-4}, time_point{0},
+                                      time_point{3}, time_point{100}};
+  const SortedEdgeIndex<time_point> index(edges);
+  for (int64_t x = -6; x < 102; ++x) {
+    EXPECT_EQ(index.upper_bound(time_point{x}),
+              std_upper_bound(edges, time_point{x}));
+  }
+}
+
+TEST(HistogramTest, sorted_edge_index_irregular) {
+  std::mt19937 rng(1234);
+  std::uniform_real_distribution<double> dist(-10.0, 10.0);
+  std::vector<double> edges(1000);
+  for (auto &edge : edges)
+    edge = dist(rng);
+  std::sort(edges.begin(), edges.end());
+  EXPECT_FALSE(SortedEdgeIndex<double>(edges).is_log());
+  check_all(edges);
+}
+
+TEST(HistogramTest, sorted_edge_index_log_spaced) {
+  std::vector<double> edges(500);
+  for (size_t i = 0; i < edges.size(); ++i)
+    edges[i] = std::pow(10.0, -3.0 + 0.02 * static_cast<double>(i));
+  EXPECT_TRUE(SortedEdgeIndex<double>(edges).is_log());
+  check_all(edges);
+}
+
+TEST(HistogramTest, sorted_edge_index_log_spaced_float) {
+  std::vector<float> edges(300);
+  for (size_t i = 0; i < edges.size(); ++i)
+    edges[i] = std::pow(10.0f, -2.0f + 0.03f * static_cast<float>(i));
+  EXPECT_TRUE(SortedEdgeIndex<float>(edges).is_log());
+  check_all(edges);
+}
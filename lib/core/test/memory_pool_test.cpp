@@ -0,0 +1,182 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <future>
+#include <thread>
+#include <vector>
+
+#include "scipp/core/element_array.h"
+#include "scipp/core/memory_pool.h"
+
+using scipp::core::element_array;
+using scipp::core::init_for_overwrite;
+using scipp::core::MemoryPool;
+
+namespace {
+bool is_aligned(const void *ptr, const size_t alignment) {
+  return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+}
+} // namespace
+
+TEST(MemoryPoolTest, size_class_rounds_up) {
+  for (const size_t size :
+       std::vector<size_t>{4097, 5000, 5120, 6000, 8192, 8193, 100000000,
+                           MemoryPool::max_pooled_size}) {
+    const auto cls = MemoryPool::size_class(size);
+    EXPECT_GE(MemoryPool::class_size(cls), size);
+    if (cls > 0) {
+      EXPECT_LT(MemoryPool::class_size(cls - 1), size);
+    }
+  }
+  EXPECT_EQ(MemoryPool::size_class(MemoryPool::min_pooled_size + 1), 0);
+  EXPECT_EQ(MemoryPool::size_class(MemoryPool::max_pooled_size),
+            MemoryPool::n_size_class - 1);
+}
+
+TEST(MemoryPoolTest, class_size_has_bounded_overhead) {
+  for (size_t cls = 1; cls < MemoryPool::n_size_class; ++cls) {
+    EXPECT_EQ(MemoryPool::size_class(MemoryPool::class_size(cls)), cls);
+    EXPECT_LE(MemoryPool::class_size(cls),
+              MemoryPool::class_size(cls - 1) * 5 / 4);
+  }
+}
+
+TEST(MemoryPoolTest, allocate_zero) {
+  MemoryPool pool;
+  EXPECT_EQ(pool.allocate(0), nullptr);
+  pool.deallocate(nullptr, 0);
+}
+
+TEST(MemoryPoolTest, small_allocations_bypass_pool) {
+  MemoryPool pool;
+  auto *ptr = pool.allocate(100);
+  EXPECT_TRUE(is_aligned(ptr, MemoryPool::alignment));
+  EXPECT_EQ(pool.stats().bytes_live, 100);
+  pool.deallocate(ptr, 100);
+  const auto stats = pool.stats();
+  EXPECT_EQ(stats.bytes_live, 0);
+  EXPECT_EQ(stats.bytes_cached, 0);
+  EXPECT_EQ(stats.hits + stats.misses, 0);
+}
+
+TEST(MemoryPoolTest, reuses_freed_block) {
+  MemoryPool pool;
+  const size_t size = 100000;
+  const auto bytes =
+      static_cast<scipp::index>(MemoryPool::class_size(pool.size_class(size)));
+  auto *ptr = pool.allocate(size);
+  EXPECT_TRUE(is_aligned(ptr, MemoryPool::alignment));
+  EXPECT_EQ(pool.stats().bytes_live, bytes);
+  EXPECT_EQ(pool.stats().misses, 1);
+  pool.deallocate(ptr, size);
+  EXPECT_EQ(pool.stats().bytes_live, 0);
+  EXPECT_EQ(pool.stats().bytes_cached, bytes);
+  // Different size, but same size class.
+  EXPECT_EQ(pool.allocate(size + 1), ptr);
+  EXPECT_EQ(pool.stats().hits, 1);
+  EXPECT_EQ(pool.stats().bytes_cached, 0);
+  EXPECT_DOUBLE_EQ(pool.stats().hit_rate(), 0.5);
+  pool.deallocate(ptr, size + 1);
+}
+
+TEST(MemoryPoolTest, huge_blocks_are_page_aligned) {
+  MemoryPool pool;
+  const size_t size = 3 * MemoryPool::huge_page_size;
+  auto *ptr = pool.allocate(size);
+  EXPECT_TRUE(is_aligned(ptr, MemoryPool::huge_page_size));
+  pool.deallocate(ptr, size);
+}
+
+TEST(MemoryPoolTest, max_cached_bytes) {
+  MemoryPool pool;
+  const size_t size = 100000;
+  const auto bytes =
+      static_cast<scipp::index>(MemoryPool::class_size(pool.size_class(size)));
+  pool.set_max_cached_bytes(bytes);
+  EXPECT_EQ(pool.max_cached_bytes(), bytes);
+  auto *a = pool.allocate(size);
+  auto *b = pool.allocate(size);
+  pool.deallocate(a, size);
+  pool.deallocate(b, size);
+  EXPECT_EQ(pool.stats().bytes_cached, bytes);
+  pool.set_max_cached_bytes(0);
+  EXPECT_EQ(pool.stats().bytes_cached, 0);
+  EXPECT_THROW(pool.set_max_cached_bytes(-1), std::invalid_argument);
+}
+
+TEST(MemoryPoolTest, max_cached_bytes_trims_to_limit) {
+  MemoryPool pool;
+  const size_t size = 100000;
+  const auto bytes =
+      static_cast<scipp::index>(MemoryPool::class_size(pool.size_class(size)));
+  auto *a = pool.allocate(size);
+  auto *b = pool.allocate(size);
+  pool.deallocate(a, size);
+  pool.deallocate(b, size);
+  EXPECT_EQ(pool.stats().bytes_cached, 2 * bytes);
+  pool.set_max_cached_bytes(bytes);
+  EXPECT_EQ(pool.stats().bytes_cached, bytes);
+}
+
+TEST(MemoryPoolTest, release) {
+  MemoryPool pool;
+  pool.deallocate(pool.allocate(100000), 100000);
+  EXPECT_GT(pool.stats().bytes_cached, 0);
+  pool.release();
+  EXPECT_EQ(pool.stats().bytes_cached, 0);
+}
+
+TEST(MemoryPoolTest, concurrent_allocate_deallocate) {
+  MemoryPool pool;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t)
+    threads.emplace_back([&pool, t]() {
+      for (size_t i = 0; i < 1000; ++i) {
+        const size_t size = 5000 + 1000 * ((i + t) % 7);
+        auto *ptr = static_cast<char *>(pool.allocate(size));
+        ptr[0] = ptr[size - 1] = static_cast<char>(t);
+        pool.deallocate(ptr, size);
+      }
+    });
+  for (auto &thread : threads)
+    thread.join();
+  const auto stats = pool.stats();
+  EXPECT_EQ(stats.bytes_live, 0);
+  EXPECT_EQ(stats.hits + stats.misses, 4000);
+  EXPECT_GT(stats.hits, 0);
+}
+
+TEST(MemoryPoolTest, release_drains_caches_of_all_threads) {
+  auto &pool = scipp::core::memory_pool();
+  std::promise<void> cached;
+  std::promise<void> released;
+  std::thread thread([&]() {
+    { element_array<double> a(100000, init_for_overwrite); }
+    cached.set_value();
+    released.get_future().wait();
+  });
+  cached.get_future().wait();
+  EXPECT_GT(pool.stats().bytes_cached, 0);
+  pool.release();
+  EXPECT_EQ(pool.stats().bytes_cached, 0);
+  released.set_value();
+  thread.join();
+}
+
+TEST(MemoryPoolTest, element_array_uses_global_pool) {
+  auto &pool = scipp::core::memory_pool();
+  const auto before = pool.stats();
+  {
+    element_array<double> a(100000, init_for_overwrite);
+    EXPECT_TRUE(is_aligned(a.data(), MemoryPool::alignment));
+    EXPECT_GE(pool.stats().bytes_live,
+              before.bytes_live +
+                  static_cast<scipp::index>(100000 * sizeof(double)));
+  }
+  EXPECT_EQ(pool.stats().bytes_live, before.bytes_live);
+  element_array<double> b(100000, 1.5);
+  EXPECT_EQ(b.data()[99999], 1.5);
+  EXPECT_GT(pool.stats().hits, before.hits);
+}
@@ -0,0 +1,64 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "scipp/core/parallel.h"
+
+using namespace scipp;
+using namespace scipp::core;
+
+TEST(ParallelTest, thread_limit_bounds_concurrency) {
+  const auto max_threads = parallel::max_concurrency();
+  {
+    parallel::ThreadLimit limit(1);
+    EXPECT_EQ(parallel::max_concurrency(), 1);
+    {
+      parallel::ThreadLimit inner(2);
+      EXPECT_LE(parallel::max_concurrency(), 2);
+    }
+    EXPECT_EQ(parallel::max_concurrency(), 1);
+  }
+  EXPECT_EQ(parallel::max_concurrency(), max_threads);
+}
+
+TEST(ParallelTest, thread_limit_requires_positive_count) {
+  EXPECT_THROW(parallel::ThreadLimit(0), std::invalid_argument);
+  EXPECT_THROW(parallel::ThreadLimit(-1), std::invalid_argument);
+}
+
+TEST(ParallelTest, set_max_threads) {
+  const auto max_threads = parallel::max_concurrency();
+  EXPECT_THROW(parallel::set_max_threads(-1), std::invalid_argument);
+  parallel::set_max_threads(1);
+  EXPECT_EQ(parallel::max_concurrency(), 1);
+  parallel::set_max_threads(0);
+  EXPECT_EQ(parallel::max_concurrency(), max_threads);
+}
+
+TEST(ParallelTest, parallel_for_in_thread_limit) {
+  std::vector<scipp::index> values(100000);
+  parallel::ThreadLimit limit(2);
+  parallel::parallel_for(parallel::blocked_range(0, scipp::size(values)),
+                         [&](const auto &range) {
+                           for (auto i = range.begin(); i < range.end(); ++i)
+                             values[i] = i;
+                         });
+  std::vector<scipp::index> expected(values.size());
+  std::iota(expected.begin(), expected.end(), 0);
+  EXPECT_EQ(values, expected);
+}
+
+TEST(ParallelTest, parallel_for_small_range) {
+  scipp::index calls = 0;
+  parallel::parallel_for(parallel::blocked_range(0, 10, 10),
+                         [&](const auto &range) {
+                           ++calls;
+                           EXPECT_EQ(range.begin(), 0);
+                           EXPECT_EQ(range.end(), 10);
+                         });
+  EXPECT_EQ(calls, 1);
+}
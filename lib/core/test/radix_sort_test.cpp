@@ -0,0 +1,86 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include "scipp/core/radix_sort.h"
+
+using namespace scipp;
+using namespace scipp::core;
+
+namespace {
+template <class T> void expect_key_order(const std::vector<T> &sorted) {
+  for (size_t i = 1; i < sorted.size(); ++i)
+    EXPECT_LT(radix_key(sorted[i - 1]), radix_key(sorted[i])) << i;
+}
+} // namespace
+
+TEST(RadixSortTest, key_order_int) {
+  expect_key_order<int32_t>({std::numeric_limits<int32_t>::min(), -2, -1, 0,
+                             1, std::numeric_limits<int32_t>::max()});
+  expect_key_order<int64_t>({std::numeric_limits<int64_t>::min(), -2, -1, 0,
+                             1, std::numeric_limits<int64_t>::max()});
+  expect_key_order<time_point>({time_point{-1}, time_point{0}, time_point{3}});
+}
+
+TEST(RadixSortTest, key_order_float) {
+  constexpr auto inf = std::numeric_limits<double>::infinity();
+  expect_key_order<double>({-inf, -1e300, -1.5, -1e-300, 0.0, 1e-300, 1.5,
+                            1e300, inf, std::nan("")});
+  expect_key_order<float>({-INFINITY, -1.5f, 0.0f, 1.5f, INFINITY, NAN});
+}
+
+TEST(RadixSortTest, key_nan_and_zero_compare_equal) {
+  EXPECT_EQ(radix_key(-0.0), radix_key(0.0));
+  EXPECT_EQ(radix_key(std::nan("")), radix_key(-std::nan("")));
+  EXPECT_EQ(radix_key(-NAN), radix_key(NAN));
+}
+
+TEST(RadixSortTest, sort_with_payloads) {
+  std::vector<uint32_t> keys{3, 1, 2, 1};
+  std::vector<double> a{30, 10, 20, 11};
+  std::vector<int64_t> b{3, 1, 2, 4};
+  radix_sort(keys.data(), 4, a.data(), b.data());
+  EXPECT_EQ(keys, std::vector<uint32_t>({1, 1, 2, 3}));
+  EXPECT_EQ(a, std::vector<double>({10, 11, 20, 30}));
+  EXPECT_EQ(b, std::vector<int64_t>({1, 4, 2, 3}));
+}
+
+TEST(RadixSortTest, sort_empty) {
+  std::vector<uint64_t> keys;
+  radix_sort(keys.data(), 0);
+  EXPECT_TRUE(keys.empty());
+}
+
+TEST(RadixSortTest, argsort_matches_stable_sort) {
+  // Large enough for multiple chunks, with many ties and NaNs.
+  const scipp::index n = 5 * radix_detail::min_chunk + 3;
+  std::vector<double> values(n);
+  for (scipp::index i = 0; i < n; ++i)
+    values[i] = i % 97 == 0 ? std::nan("") : ((i * 7919) % 1009) - 500.0;
+  for (const bool descending : {false, true}) {
+    std::vector<int64_t> expected(n);
+    std::iota(expected.begin(), expected.end(), 0);
+    std::stable_sort(expected.begin(), expected.end(), [&](auto i, auto j) {
+      const auto a = values[i];
+      const auto b = values[j];
+      if (descending)
+        return std::isnan(a) ? !std::isnan(b) : b < a;
+      return std::isnan(b) ? !std::isnan(a) : a < b;
+    });
+    EXPECT_EQ(radix_argsort<int64_t>(values.data(), n, descending), expected);
+  }
+}
+
+TEST(RadixSortTest, argsort_time_point) {
+  const std::vector<time_point> values{time_point{1600000000000000005},
+                                       time_point{1600000000000000001},
+                                       time_point{1600000000000000003}};
+  EXPECT_EQ(radix_argsort<int32_t>(values.data(), 3, false),
+            std::vector<int32_t>({1, 2, 0}));
+}
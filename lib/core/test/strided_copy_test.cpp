@@ -0,0 +1,102 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "scipp/core/strided_copy.h"
+
+using namespace scipp;
+using namespace scipp::core;
+
+class StridedCopyTest : public ::testing::Test {
+protected:
+  /// Copy `src`, viewed with `dims`, with strided_copy and compare to a copy
+  /// using the iterators of ElementArrayView.
+  void check(const ElementArrayView<const double> &src_base,
+             const Dimensions &dims) {
+    const ElementArrayView<const double> src(src_base, dims);
+    std::vector<double> out(dims.volume(), -1.0);
+    ElementArrayView<double> dst(out.data(), 0, dims, Strides{dims});
+    ASSERT_TRUE(can_strided_copy(src, dst));
+    strided_copy(src, dst);
+    std::vector<double> expected(dims.volume());
+    std::copy(src.begin(), src.end(), expected.begin());
+    EXPECT_EQ(out, expected);
+  }
+
+  auto make_view(const Dimensions &dims) {
+    buffer.resize(dims.volume());
+    std::iota(buffer.begin(), buffer.end(), 0.0);
+    return ElementArrayView<const double>(buffer.data(), 0, dims,
+                                          Strides{dims});
+  }
+
+  std::vector<double> buffer;
+};
+
+TEST_F(StridedCopyTest, scalar) {
+  const Dimensions dims;
+  check(make_view(dims), dims);
+}
+
+TEST_F(StridedCopyTest, contiguous) {
+  const Dimensions dims({{Dim::Z, 3}, {Dim::Y, 4}, {Dim::X, 5}});
+  check(make_view(dims), dims);
+}
+
+TEST_F(StridedCopyTest, slice) {
+  const Dimensions dims({{Dim::Y, 4}, {Dim::X, 5}});
+  make_view(dims);
+  const Dimensions inner({{Dim::Y, 3}, {Dim::X, 2}});
+  check(ElementArrayView<const double>(buffer.data(), 1, inner, Strides{dims}),
+        inner);
+  const Dimensions outer({{Dim::Y, 2}, {Dim::X, 5}});
+  check(ElementArrayView<const double>(buffer.data(), 0, outer, Strides{10, 1}),
+        outer);
+}
+
+TEST_F(StridedCopyTest, broadcast) {
+  const auto base = make_view(Dimensions{Dim::X, 5});
+  check(base, Dimensions({{Dim::Y, 3}, {Dim::X, 5}}));
+  check(base, Dimensions({{Dim::X, 5}, {Dim::Y, 3}}));
+}
+
+TEST_F(StridedCopyTest, transpose_2d) {
+  // Sizes are not multiples of the tile size.
+  const auto base = make_view(Dimensions({{Dim::Y, 37}, {Dim::X, 45}}));
+  check(base, Dimensions({{Dim::X, 45}, {Dim::Y, 37}}));
+}
+
+TEST_F(StridedCopyTest, transpose_3d) {
+  const auto base =
+      make_view(Dimensions({{Dim::Z, 3}, {Dim::Y, 40}, {Dim::X, 70}}));
+  check(base, Dimensions({{Dim::Z, 3}, {Dim::X, 70}, {Dim::Y, 40}}));
+  check(base, Dimensions({{Dim::X, 70}, {Dim::Y, 40}, {Dim::Z, 3}}));
+  check(base, Dimensions({{Dim::Y, 40}, {Dim::X, 70}, {Dim::Z, 3}}));
+  check(base, Dimensions({{Dim::X, 70}, {Dim::Z, 3}, {Dim::Y, 40}}));
+}
+
+TEST_F(StridedCopyTest, empty) {
+  const auto base = make_view(Dimensions({{Dim::Y, 0}, {Dim::X, 4}}));
+  check(base, Dimensions({{Dim::X, 4}, {Dim::Y, 0}}));
+}
+
+TEST_F(StridedCopyTest, cannot_copy_into_overlapping_view) {
+  const Dimensions dims({{Dim::Y, 2}, {Dim::X, 4}});
+  std::vector<double> data(dims.volume());
+  ElementArrayView<double> dst(data.data(), 0, dims, Strides{dims});
+  const ElementArrayView<const double> src(data.data(), 1, dims,
+                                           Strides{dims});
+  EXPECT_FALSE(can_strided_copy(src, dst));
+}
+
+TEST_F(StridedCopyTest, cannot_copy_into_broadcast) {
+  const Dimensions dims({{Dim::Y, 2}, {Dim::X, 4}});
+  std::vector<double> data(4);
+  ElementArrayView<double> dst(data.data(), 0, dims, Strides{0, 1});
+  const auto src = make_view(dims);
+  EXPECT_FALSE(can_strided_copy(src, dst));
+}
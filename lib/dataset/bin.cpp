@@ -161,6 +161,9 @@ DataArray add_metadata(std::tuple<DataArray, Variable> &&proto,
       std::move(out_coords), std::move(out_masks), std::move(out_attrs)};
 }
 
+} // namespace
+
+namespace bin_detail {
 class TargetBinBuilder {
   enum class AxisAction { Group, Bin, Existing, Join };
 
@@ -177,13 +180,18 @@ public:
     const auto get_coord = [&](const Dim dim) {
       return coords.count(dim) ? coords[dim] : bin_coords.at(dim);
     };
-    m_offsets = makeVariable<scipp::index>(Values{0}, units::none);
-    m_nbin = dims().volume() * units::none;
-    for (const auto &[action, dim, key] : m_actions) {
-      if (action == AxisAction::Group)
-        update_indices_by_grouping(indices, get_coord(dim), key);
-      else if (action == AxisAction::Bin) {
-        const auto linspace = all(islinspace(key, dim)).template value<bool>();
+    reset_offsets();
+    const bool prepared = m_lookup.size() == m_actions.size();
+    for (size_t i = 0; i < m_actions.size(); ++i) {
+      const auto &[action, dim, key] = m_actions[i];
+      if (action == AxisAction::Group) {
+        if (prepared)
+          update_indices_by_group_map(indices, get_coord(dim), m_lookup[i]);
+        else
+          update_indices_by_grouping(indices, get_coord(dim), key);
+      } else if (action == AxisAction::Bin) {
+        const auto linspace =
+            prepared ? m_lookup[i].value<bool>() : is_linspace(key, dim);
         // When binning along an existing dim with a coord (may be edges or
         // not), not all input bins can map to all output bins. The array of
         // subbin sizes that is normally created thus contains mainly zero
@@ -260,6 +268,24 @@ public:
     }
   }
 
+  /// Precompute group maps and edge kinds, which depend only on the groups and
+  /// edges. Subsequent calls to `build` use these instead of recomputing them,
+  /// which is useful when building target bins for many inputs. Offsets are
+  /// initialized as for inputs without prior binning.
+  void prepare(const DType index_dtype) {
+    reset_offsets();
+    m_lookup.clear();
+    for (const auto &[action, dim, key] : m_actions) {
+      if (action == AxisAction::Group)
+        m_lookup.emplace_back(groups_to_map(key, index_dtype));
+      else if (action == AxisAction::Bin)
+        m_lookup.emplace_back(
+            makeVariable<bool>(Values{is_linspace(key, dim)}));
+      else
+        m_lookup.emplace_back();
+    }
+  }
+
   [[nodiscard]] auto edges() const noexcept {
     std::vector<Variable> vars;
     for (const auto &[action, dim, key] : m_actions) {
@@ -307,12 +333,25 @@ public:
   void erase(const Dim dim) { m_dims.addInner(dim, 1); }
 
 private:
+  void reset_offsets() {
+    m_offsets = makeVariable<scipp::index>(Values{0}, units::none);
+    m_nbin = dims().volume() * units::none;
+  }
+
+  static bool is_linspace(const Variable &edges, const Dim dim) {
+    return edge_kind(edges, dim) == variable::EdgeKind::Linspace;
+  }
+
   Dimensions m_dims;
   Variable m_offsets;
   Variable m_nbin;
   std::vector<std::tuple<AxisAction, Dim, Variable>> m_actions;
   std::vector<Variable> m_joined;
+  std::vector<Variable> m_lookup;
 };
+} // namespace bin_detail
+
+namespace {
 
 // Order is defined as:
 // 1. Erase binning from any dimensions listed in erase
@@ -447,16 +486,8 @@ DataArray groupby_concat_bins(const DataArray &array, const Variable &edges,
 }
 
 namespace {
-void validate_bin_args(const DataArray &array,
-                       const std::vector<Variable> &edges,
-                       const std::vector<Variable> &groups) {
-  if ((is_bins(array) &&
-       std::get<2>(array.data().constituents<DataArray>()).dims().ndim() > 1) ||
-      (!is_bins(array) && array.dims().ndim() > 1)) {
-    throw except::BinnedDataError(
-        "Binning is only implemented for 1-dimensional data. Consider using "
-        "groupby, it might be able to do what you need.");
-  }
+void validate_edges_and_groups(const std::vector<Variable> &edges,
+                               const std::vector<Variable> &groups) {
   if (edges.empty() && groups.empty())
     throw std::invalid_argument(
         "Arguments 'edges' and 'groups' of scipp.bin are "
@@ -472,6 +503,19 @@ void validate_bin_args(const DataArray &array,
   }
 }
 
+void validate_bin_args(const DataArray &array,
+                       const std::vector<Variable> &edges,
+                       const std::vector<Variable> &groups) {
+  if ((is_bins(array) &&
+       std::get<2>(array.data().constituents<DataArray>()).dims().ndim() > 1) ||
+      (!is_bins(array) && array.dims().ndim() > 1)) {
+    throw except::BinnedDataError(
+        "Binning is only implemented for 1-dimensional data. Consider using "
+        "groupby, it might be able to do what you need.");
+  }
+  validate_edges_and_groups(edges, groups);
+}
+
 auto drop_grouped_event_coords(const Variable &data,
                                const std::vector<Variable> &groups) {
   auto [indices, dim, buffer] = data.constituents<DataArray>();
@@ -484,6 +528,47 @@ auto drop_grouped_event_coords(const Variable &data,
   return make_bins_no_validate(indices, dim, buffer);
 }
 
+DType target_bins_dtype(const Dimensions &target_dims) {
+  return target_dims.volume() > std::numeric_limits<int32_t>::max()
+             ? dtype<int64_t>
+             : dtype<int32_t>;
+}
+
+auto make_target_bins_buffer(const Dimensions &dims,
+                             const Dimensions &target_dims) {
+  return target_bins_dtype(target_dims) == dtype<int64_t>
+             ? makeVariable<int64_t>(dims, units::none)
+             : makeVariable<int32_t>(dims, units::none);
+}
+
+/// Bin a table, i.e., dense 1-D data, given the target bin of every row.
+DataArray bin_table(const DataArray &array, const Variable &target_bins_buffer,
+                    const TargetBinBuilder &builder,
+                    const std::vector<Variable> &edges,
+                    const std::vector<Variable> &groups,
+                    const std::vector<Dim> &erase) {
+  // Pretend existing binning along outermost binning dim to enable threading
+  const auto &data = array.data();
+  const auto dim = data.dims().inner();
+  const auto size = std::max(scipp::index(1), data.dims()[dim]);
+  // TODO automatic setup with reasonable bin count
+  const auto stride = std::max(scipp::index(1), size / 24);
+  auto begin = make_range(0, size, stride,
+                          groups.empty() ? edges.front().dims().inner()
+                                         : groups.front().dims().inner());
+  auto end = begin + stride * units::none;
+  end.values<scipp::index>().as_span().back() = data.dims()[dim];
+  const auto indices = zip(begin, end);
+  const auto tmp = make_bins_no_validate(indices, dim, array);
+  const auto target_bins =
+      make_bins_no_validate(indices, dim, target_bins_buffer);
+  return add_metadata(
+      setup_and_apply<DataArray>(drop_grouped_event_coords(tmp, groups),
+                                 target_bins, builder),
+      array.coords(), array.masks(), array.attrs(), builder.edges(),
+      builder.groups(), erase);
+}
+
 } // namespace
 
 DataArray bin(const DataArray &array, const std::vector<Variable> &edges,
@@ -498,33 +583,64 @@ DataArray bin(const DataArray &array, const std::vector<Variable> &edges,
   if (data.dtype() == dtype<core::bin<DataArray>>) {
     return bin(data, coords, masks, attrs, edges, groups, erase);
   } else {
-    // Pretend existing binning along outermost binning dim to enable threading
-    const auto dim = data.dims().inner();
-    const auto size = std::max(scipp::index(1), data.dims()[dim]);
-    // TODO automatic setup with reasonable bin count
-    const auto stride = std::max(scipp::index(1), size / 24);
-    auto begin = make_range(0, size, stride,
-                            groups.empty() ? edges.front().dims().inner()
-                                           : groups.front().dims().inner());
-    auto end = begin + stride * units::none;
-    end.values<scipp::index>().as_span().back() = data.dims()[dim];
-    const auto indices = zip(begin, end);
-    const auto tmp = make_bins_no_validate(indices, dim, array);
-    auto target_bins_buffer =
-        (data.dims().volume() > std::numeric_limits<int32_t>::max())
-            ? makeVariable<int64_t>(data.dims(), units::none)
-            : makeVariable<int32_t>(data.dims(), units::none);
+    auto target_bins_buffer = make_target_bins_buffer(data.dims(), data.dims());
     auto builder = axis_actions(data, meta, edges, groups, erase);
     builder.build(target_bins_buffer, meta);
-    const auto target_bins =
-        make_bins_no_validate(indices, dim, target_bins_buffer);
-    return add_metadata(
-        setup_and_apply<DataArray>(drop_grouped_event_coords(tmp, groups),
-                                   target_bins, builder),
-        coords, masks, attrs, builder.edges(), builder.groups(), erase);
+    return bin_table(array, target_bins_buffer, builder, edges, groups, erase);
   }
 }
 
+BinPlan::BinPlan(const std::vector<Variable> &edges,
+                 const std::vector<Variable> &groups) {
+  validate_edges_and_groups(edges, groups);
+  for (const auto &group : groups)
+    m_groups.emplace_back(copy(group));
+  for (const auto &edge : edges)
+    m_edges.emplace_back(copy(edge));
+  // Same order of actions as `axis_actions` for a table with a dim that is not
+  // binned or grouped.
+  auto builder = std::make_shared<TargetBinBuilder>();
+  for (const auto &group : m_groups)
+    builder->group(group);
+  for (const auto &edge : m_edges)
+    builder->bin(edge);
+  builder->prepare(target_bins_dtype(builder->dims()));
+  m_builder = std::move(builder);
+}
+
+const Dimensions &BinPlan::dims() const noexcept { return m_builder->dims(); }
+
+/// Return the index of the target bin for every row of `table`.
+///
+/// The result can be passed to `apply` to bin multiple tables with identical
+/// coords without recomputing the indices.
+Variable BinPlan::target_bins(const DataArray &table) const {
+  if (is_bins(table) || table.dims().ndim() != 1)
+    throw except::BinnedDataError(
+        "BinPlan can only be applied to 1-dimensional dense data.");
+  if (dims().contains(table.dims().inner()))
+    throw except::DimensionError(
+        "BinPlan cannot be applied to a table with dimension '" +
+        to_string(table.dims().inner()) +
+        "' since this dimension is binned or grouped by the plan.");
+  auto target_bins = make_target_bins_buffer(table.dims(), dims());
+  auto builder = *m_builder;
+  builder.build(target_bins, table.meta());
+  return target_bins;
+}
+
+DataArray BinPlan::apply(const DataArray &table) const {
+  return apply(table, target_bins(table));
+}
+
+/// Bin `table` using target bin indices previously returned by `target_bins`.
+DataArray BinPlan::apply(const DataArray &table,
+                         const Variable &target_bins) const {
+  core::expect::equals(target_bins.dims(), table.dims());
+  core::expect::equals(target_bins.dtype(), target_bins_dtype(dims()));
+  return bin_table(table, target_bins, *m_builder, m_edges, m_groups, {});
+}
+
 /// Implementation of a generic binning algorithm.
 ///
 /// The overall approach of this is as follows:
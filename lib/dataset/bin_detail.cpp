@@ -59,12 +59,23 @@ Variable groups_to_map(const Variable &var, const Dim dim) {
 }
 } // namespace
 
+/// Return lookup table from group label to index of type `index_dtype`.
+Variable groups_to_map(const Variable &groups, const DType index_dtype) {
+  const auto dim = groups.dims().inner();
+  return index_dtype == dtype<int64_t> ? groups_to_map<int64_t>(groups, dim)
+                                       : groups_to_map<int32_t>(groups, dim);
+}
+
 void update_indices_by_grouping(Variable &indices, const Variable &key,
                                 const Variable &groups) {
-  const auto dim = groups.dims().inner();
-  const auto map = (indices.dtype() == dtype<int64_t>)
-                       ? groups_to_map<int64_t>(groups, dim)
-                       : groups_to_map<int32_t>(groups, dim);
+  update_indices_by_group_map(indices, key,
+                              groups_to_map(groups, indices.dtype()));
+}
+
+/// Variant of update_indices_by_grouping with a map precomputed using
+/// `groups_to_map`.
+void update_indices_by_group_map(Variable &indices, const Variable &key,
+                                 const Variable &map) {
   variable::transform_in_place(indices, key, map,
                                core::element::update_indices_by_grouping,
                                "scipp.bin.update_indices_by_grouping");
@@ -26,8 +26,11 @@ Variable make_range(const scipp::index begin, const scipp::index end,
 
 void update_indices_by_binning(Variable &indices, const Variable &key,
                                const Variable &edges, const bool linspace);
+Variable groups_to_map(const Variable &groups, const DType index_dtype);
 void update_indices_by_grouping(Variable &indices, const Variable &key,
                                 const Variable &groups);
+void update_indices_by_group_map(Variable &indices, const Variable &key,
+                                 const Variable &map);
 void update_indices_from_existing(Variable &indices, const Dim dim);
 Variable bin_sizes(const Variable &sub_bin, const Variable &offset,
                    const Variable &nbin);
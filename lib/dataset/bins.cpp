@@ -4,11 +4,15 @@
 /// @author Simon Heybrock
 #include <algorithm>
 #include <limits>
+#include <numeric>
 
 #include "scipp/core/bucket.h"
 #include "scipp/core/element/event_operations.h"
 #include "scipp/core/element/histogram.h"
 #include "scipp/core/except.h"
+#include "scipp/core/parallel.h"
+#include "scipp/core/radix_sort.h"
+#include "scipp/core/tag_util.h"
 
 #include "scipp/variable/arithmetic.h"
 #include "scipp/variable/bins.h"
@@ -25,10 +29,12 @@
 #include "scipp/dataset/bins.h"
 #include "scipp/dataset/bins_view.h"
 #include "scipp/dataset/dataset.h"
+#include "scipp/dataset/extract.h"
 #include "scipp/dataset/histogram.h"
 
 #include "../variable/operations_common.h"
 #include "bin_common.h"
+#include "bins_util.h"
 #include "dataset_operations_common.h"
 
 namespace scipp::dataset {
@@ -244,6 +250,344 @@ auto concatenate_impl(const Variable &var0, const Variable &var1) {
   return combine<T>(var0, var1);
 }
 
+auto index_pairs(const Variable &indices) {
+  const auto values = indices.values<scipp::index_pair>();
+  return std::vector<scipp::index_pair>(values.begin(), values.end());
+}
+
+auto make_indices(const Dimensions &dims,
+                  const std::vector<scipp::index_pair> &ranges) {
+  return makeVariable<scipp::index_pair>(dims, units::none,
+                                         Values(ranges.begin(), ranges.end()));
+}
+
+/// Return the end of the capacity of every bin, i.e., the begin of the next
+/// bin in the buffer, or an empty vector if bins are not ordered in the
+/// buffer.
+auto capacity_ends(const std::vector<scipp::index_pair> &ranges,
+                   const scipp::index buffer_size) {
+  std::vector<scipp::index> ends(ranges.size());
+  for (scipp::index i = scipp::size(ranges) - 1; i >= 0; --i) {
+    ends[i] = i + 1 < scipp::size(ranges) ? ranges[i + 1].first : buffer_size;
+    if (ranges[i].second > ends[i])
+      return std::vector<scipp::index>{};
+  }
+  return ends;
+}
+
+/// Replace indices and buffer of `var` in its underlying model, i.e., all
+/// variables sharing the model see the change.
+///
+/// New indices are installed instead of writing to the existing ones, since
+/// those may be shared with other variables, such as views of the bins, which
+/// still refer to the previous buffer.
+template <class T>
+void set_bins_in_place(Variable &var,
+                       const std::vector<scipp::index_pair> &ranges,
+                       T &&buffer) {
+  set_bin_indices(var, make_indices(var.dims(), ranges));
+  var.bin_buffer<std::decay_t<T>>() = std::forward<T>(buffer);
+}
+
+/// Append bin contents of `var1` to the bins of `var0`, in place.
+///
+/// Bins may have unused capacity at their end, i.e., up to the begin of the
+/// next bin in the buffer, if the buffer was allocated by a previous append.
+/// If every bin has sufficient capacity and the bin indices are not shared
+/// with other variables the new elements are copied there and only the bin end
+/// indices are updated, so the cost does not depend on the size of `var0`.
+/// Otherwise the buffer is
+/// reallocated and every bin is given additional capacity, similar to the
+/// geometric growth of std::vector. Repeatedly appending small batches thus
+/// has an amortized cost proportional to the batch size. Use `compact` to
+/// remove the unused capacity.
+template <class T> void append_impl(Variable &var0, const Variable &var1) {
+  if (var0.is_slice() || var0.dims() != var1.dims()) {
+    var0.setDataHandle(combine<T>(var0, var1).data_handle());
+    return;
+  }
+  // Checked before `constituents` adds references to the indices.
+  const bool unique_indices = has_unique_bin_indices(var0);
+  const auto &[indices1, dim1, buffer1] = var1.constituents<T>();
+  static_cast<void>(dim1);
+  const auto &[indices0, dim, buffer0] = var0.constituents<T>();
+  auto ranges = index_pairs(indices0);
+  const auto ranges1 = index_pairs(indices1);
+  const auto ends = capacity_ends(ranges, buffer0.dims()[dim]);
+  bool fits = (unique_indices && has_capacity(var0) && !ends.empty()) ||
+              ranges.empty();
+  for (size_t i = 0; fits && i < ends.size(); ++i)
+    fits = ranges[i].second + ranges1[i].second - ranges1[i].first <= ends[i];
+  if (fits) {
+    auto target = ranges;
+    for (size_t i = 0; i < ranges.size(); ++i) {
+      target[i] = {ranges[i].second,
+                   ranges[i].second + ranges1[i].second - ranges1[i].first};
+      ranges[i].second = target[i].second;
+    }
+    copy_slices(buffer1, buffer0, dim, indices1,
+                make_indices(var0.dims(), target));
+    copy(make_indices(var0.dims(), ranges), var0.bin_indices());
+    return;
+  }
+  // Reallocate, with capacity for every bin given by its new size plus slack
+  // of half its size and half the mean bin size, i.e., twice the total size.
+  scipp::index total = 0;
+  for (size_t i = 0; i < ranges.size(); ++i)
+    total += ranges[i].second - ranges[i].first + ranges1[i].second -
+             ranges1[i].first;
+  const auto mean_slack =
+      ranges.empty() ? 0 : (total + 2 * scipp::size(ranges) - 1) /
+                               (2 * scipp::size(ranges));
+  std::vector<scipp::index_pair> old_target(ranges.size());
+  std::vector<scipp::index_pair> new_target(ranges.size());
+  scipp::index begin = 0;
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    const auto size0 = ranges[i].second - ranges[i].first;
+    const auto size = size0 + ranges1[i].second - ranges1[i].first;
+    old_target[i] = {begin, begin + size0};
+    new_target[i] = {begin + size0, begin + size};
+    ranges[i] = {begin, begin + size};
+    begin += size + size / 2 + mean_slack;
+  }
+  auto buffer = resize_default_init(buffer0, dim, begin);
+  copy_slices(buffer0, buffer, dim, indices0,
+              make_indices(var0.dims(), old_target));
+  copy_slices(buffer1, buffer, dim, indices1,
+              make_indices(var0.dims(), new_target));
+  set_bins_in_place(var0, ranges, std::move(buffer));
+  set_has_capacity(var0, true);
+}
+
+template <class T> void compact_impl(Variable &var) {
+  const auto &[indices, dim, buffer] = var.constituents<T>();
+  const auto ranges = index_pairs(indices);
+  scipp::index end = 0;
+  bool dense = true;
+  for (const auto &[begin_, end_] : ranges) {
+    dense &= begin_ == end;
+    end = end_;
+  }
+  if (dense && end == buffer.dims()[dim])
+    return;
+  auto compacted = copy(var);
+  auto &&[new_indices, new_dim, new_buffer] = compacted.to_constituents<T>();
+  static_cast<void>(new_dim);
+  set_bins_in_place(var, index_pairs(new_indices), std::move(new_buffer));
+}
+
+/// Fill `perm` with the permutation of buffer rows that sorts every bin by
+/// `key`, with the sorted bins stored contiguously at `out` in bin order.
+template <class T> struct SortedBinPermutation {
+  static void apply(const Variable &key,
+                    const std::vector<scipp::index_pair> &ranges,
+                    const std::vector<scipp::index_pair> &out,
+                    std::vector<scipp::index> &perm) {
+    const T *values = key.values<T>().data();
+    core::parallel::parallel_for(
+        core::parallel::blocked_range(0, scipp::size(ranges)),
+        [&](const auto &range) {
+          for (auto bin = range.begin(); bin != range.end(); ++bin) {
+            const auto [begin, end] = ranges[bin];
+            auto *first = perm.data() + out[bin].first;
+            std::iota(first, first + (end - begin), begin);
+            if constexpr (core::is_radix_sortable_v<T>)
+              core::sort_indices(first, end - begin, values);
+            else
+              std::stable_sort(first, first + (end - begin),
+                               [values](const auto a, const auto b) {
+                                 return values[a] < values[b];
+                               });
+          }
+        });
+  }
+};
+
+Variable sort_bins(const Variable &var, const Dim key) {
+  const auto &[indices, dim, buffer] = var.constituents<DataArray>();
+  const auto &key_var = buffer.meta()[key];
+  if (key_var.dims() != Dimensions(dim, buffer.dims()[dim]))
+    throw except::DimensionError(
+        "Cannot sort bins by " + to_string(key) + " with dims " +
+        to_string(key_var.dims()) + ", key must depend only on " +
+        to_string(dim) + '.');
+  const auto ranges = index_pairs(indices);
+  std::vector<scipp::index_pair> out(ranges.size());
+  scipp::index total = 0;
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    const auto size = ranges[i].second - ranges[i].first;
+    out[i] = {total, total + size};
+    total += size;
+  }
+  std::vector<scipp::index> perm(total);
+  const auto contiguous_key = key_var.strides()[0] == 1 ? key_var
+                                                         : copy(key_var);
+  core::CallDType<double, float, int64_t, int32_t, core::time_point, bool,
+                  std::string>::apply<SortedBinPermutation>(key_var.dtype(),
+                                                            contiguous_key,
+                                                            ranges, out, perm);
+  auto sorted = make_bins_no_validate(
+      make_indices(var.dims(), out), dim,
+      extract_by_indices_unchecked(
+          makeVariable<scipp::index>(Dims{dim}, Shape{total},
+                                     Values(std::move(perm))),
+          buffer, dim));
+  set_sorted_by(sorted, key);
+  return sorted;
+}
+
+/// Half-open interval [begin, end) of radix keys, see `core::radix_key`.
+///
+/// Invalid `begin` or `end` variables denote an unbounded interval, i.e., an
+/// unbounded end includes NaN.
+template <class T> struct KeyInterval {
+  using U = core::radix_key_t<T>;
+  KeyInterval(const Variable &begin, const Variable &end)
+      : first(begin.is_valid() ? core::radix_key(begin.value<T>()) : U{0}),
+        last(end.is_valid() ? core::radix_key(end.value<T>()) : U{0}),
+        bounded(end.is_valid()) {}
+  bool contains(const T &x) const noexcept {
+    const auto k = core::radix_key(x);
+    return k >= first && (!bounded || k < last);
+  }
+  U first;
+  U last;
+  bool bounded;
+};
+
+/// Shrink `ranges` to the elements with key in [begin, end), for bins sorted
+/// by key, see `sorted_by`. This uses two binary searches per bin.
+template <class T> struct SortedBinSlice {
+  static void apply(const Variable &key, const Variable &begin,
+                    const Variable &end,
+                    std::vector<scipp::index_pair> &ranges) {
+    const T *values = key.values<T>().data();
+    const KeyInterval<T> interval(begin, end);
+    const auto less = [](const T &x, const auto k) {
+      return core::radix_key(x) < k;
+    };
+    core::parallel::parallel_for(
+        core::parallel::blocked_range(0, scipp::size(ranges)),
+        [&](const auto &range) {
+          for (auto bin = range.begin(); bin != range.end(); ++bin) {
+            const auto *first = values + ranges[bin].first;
+            const auto *last = values + ranges[bin].second;
+            first = std::lower_bound(first, last, interval.first, less);
+            if (interval.bounded)
+              last = std::lower_bound(first, last, interval.last, less);
+            ranges[bin] = {first - values, last - values};
+          }
+        });
+  }
+};
+
+/// Fill `selected` with the indices of the elements with key in [begin, end)
+/// of all bins, and set `out` to the ranges of every bin in `selected`. This
+/// scans all elements, preserving their order.
+template <class T> struct BinSliceSelection {
+  static void apply(const Variable &key, const Variable &begin,
+                    const Variable &end,
+                    const std::vector<scipp::index_pair> &ranges,
+                    std::vector<scipp::index_pair> &out,
+                    std::vector<scipp::index> &selected) {
+    const T *values = key.values<T>().data();
+    const KeyInterval<T> interval(begin, end);
+    const auto for_each_bin = [&ranges](const auto &op) {
+      core::parallel::parallel_for(
+          core::parallel::blocked_range(0, scipp::size(ranges)),
+          [&op](const auto &range) {
+            for (auto bin = range.begin(); bin != range.end(); ++bin)
+              op(bin);
+          });
+    };
+    std::vector<scipp::index> counts(ranges.size());
+    for_each_bin([&](const scipp::index bin) {
+      const auto [first, last] = ranges[bin];
+      counts[bin] = std::count_if(values + first, values + last,
+                                  [&interval](const T &x) {
+                                    return interval.contains(x);
+                                  });
+    });
+    scipp::index total = 0;
+    for (size_t bin = 0; bin < ranges.size(); ++bin) {
+      out[bin] = {total, total + counts[bin]};
+      total += counts[bin];
+    }
+    selected.resize(total);
+    for_each_bin([&](const scipp::index bin) {
+      auto *dst = selected.data() + out[bin].first;
+      for (auto i = ranges[bin].first; i < ranges[bin].second; ++i)
+        if (interval.contains(values[i]))
+          *dst++ = i;
+    });
+  }
+};
+
+void expect_valid_slice_bound(const Variable &key, const Variable &bound,
+                              const std::string &name) {
+  if (!bound.is_valid())
+    return;
+  core::expect::equals(Dimensions{}, bound.dims());
+  if (bound.unit() != key.unit())
+    throw except::UnitError("The unit of the slice " + name + " (" +
+                            to_string(bound.unit()) +
+                            ") does not match the unit of the coordinate (" +
+                            to_string(key.unit()) + ").");
+  if (bound.dtype() != key.dtype())
+    throw except::TypeError("The dtype of the slice " + name + " (" +
+                            to_string(bound.dtype()) +
+                            ") does not match the dtype of the coordinate (" +
+                            to_string(key.dtype()) + ").");
+}
+
+Variable slice_bins(const Variable &var, const Dim key, const Variable &begin,
+                    const Variable &end, const bool view) {
+  using KeyTypes = core::CallDType<double, float, int64_t, int32_t,
+                                   core::time_point>;
+  if (var.dtype() != dtype<bucket<DataArray>>)
+    throw except::TypeError("Slicing bins by a coord requires bins with "
+                            "dtype DataArray, got " +
+                            to_string(var.dtype()) + '.');
+  const auto &[indices, dim, buffer] = var.constituents<DataArray>();
+  const auto &key_var = buffer.meta()[key];
+  if (key_var.dims() != Dimensions(dim, buffer.dims()[dim]))
+    throw except::DimensionError(
+        "Cannot slice bins by " + to_string(key) + " with dims " +
+        to_string(key_var.dims()) + ", key must depend only on " +
+        to_string(dim) + '.');
+  expect_valid_slice_bound(key_var, begin, "begin");
+  expect_valid_slice_bound(key_var, end, "end");
+  const bool sorted = sorted_by(var) == key;
+  if (view && !sorted)
+    throw except::BinnedDataError(
+        "Cannot slice bins by " + to_string(key) +
+        " without copy since the bins are not sorted by " + to_string(key) +
+        ". Use `sort` first, or slice with a copy.");
+  const auto contiguous_key = key_var.strides()[0] == 1 ? key_var
+                                                         : copy(key_var);
+  auto ranges = index_pairs(indices);
+  if (sorted) {
+    KeyTypes::apply<SortedBinSlice>(key_var.dtype(), contiguous_key, begin,
+                                    end, ranges);
+    auto sliced = make_bins_no_validate(make_indices(var.dims(), ranges), dim,
+                                        buffer);
+    if (!view)
+      sliced = copy(sliced);
+    set_sorted_by(sliced, key);
+    return sliced;
+  }
+  std::vector<scipp::index_pair> out(ranges.size());
+  std::vector<scipp::index> selected;
+  KeyTypes::apply<BinSliceSelection>(key_var.dtype(), contiguous_key, begin,
+                                     end, ranges, out, selected);
+  const auto size = scipp::size(selected);
+  return make_bins_no_validate(
+      make_indices(var.dims(), out), dim,
+      extract_by_indices_unchecked(
+          makeVariable<scipp::index>(Dims{dim}, Shape{size},
+                                     Values(std::move(selected))),
+          buffer, dim));
+}
 } // namespace
 
 Variable concatenate(const Variable &var0, const Variable &var1) {
@@ -281,11 +625,11 @@ DataArray concatenate(const DataArray &array, const Dim dim) {
 
 void append(Variable &var0, const Variable &var1) {
   if (var0.dtype() == dtype<bucket<Variable>>)
-    var0.setDataHandle(combine<Variable>(var0, var1).data_handle());
+    append_impl<Variable>(var0, var1);
   else if (var0.dtype() == dtype<bucket<DataArray>>)
-    var0.setDataHandle(combine<DataArray>(var0, var1).data_handle());
+    append_impl<DataArray>(var0, var1);
   else
-    var0.setDataHandle(combine<Dataset>(var0, var1).data_handle());
+    append_impl<Dataset>(var0, var1);
 }
 
 void append(Variable &&var0, const Variable &var1) { append(var0, var1); }
@@ -298,6 +642,82 @@ void append(DataArray &a, const DataArray &b) {
   a.setData(data);
 }
 
+/// Remove unused capacity between and after bins, left by `append`.
+///
+/// The bin contents are moved into a new buffer without gaps, unless the
+/// buffer is dense already.
+void compact(Variable &var) {
+  if (var.is_slice())
+    throw except::SliceError("Cannot compact a slice of binned data.");
+  if (var.dtype() == dtype<bucket<Variable>>)
+    compact_impl<Variable>(var);
+  else if (var.dtype() == dtype<bucket<DataArray>>)
+    compact_impl<DataArray>(var);
+  else
+    compact_impl<Dataset>(var);
+}
+
+void compact(DataArray &array) {
+  auto data = array.data();
+  compact(data);
+}
+
+/// Return binned data with the contents of every bin sorted by `key`.
+///
+/// `key` is a coord (or attr) of the bin contents. Bins are sorted in parallel
+/// and stably, with NaNs last. All columns of the bin contents are reordered in
+/// a single gather pass into a new buffer without gaps between bins. The
+/// result is marked as sorted, see `sorted_by`, and its key coord is read-only.
+Variable sort(const Variable &var, const Dim key) {
+  if (var.dtype() != dtype<bucket<DataArray>>)
+    throw except::TypeError("Sorting bins by a coord requires bins with "
+                            "dtype DataArray, got " +
+                            to_string(var.dtype()) + '.');
+  return sort_bins(var, key);
+}
+
+DataArray sort(const DataArray &array, const Dim key) {
+  return DataArray(sort(array.data(), key), array.coords(), array.masks(),
+                   array.attrs(), array.name());
+}
+
+/// Return binned data with the contents of every bin restricted to elements
+/// with `key` in the half-open interval [begin, end).
+///
+/// Invalid `begin` or `end` denote an unbounded interval. The result is a copy
+/// and does not share its buffer with `var`. If the bins are sorted by `key`,
+/// see `sorted_by` and `sort`, the bin ranges are found by binary search and
+/// only the selected elements are read. Otherwise all elements are scanned.
+/// See `slice_view` for slicing sorted bins without copy.
+Variable slice(const Variable &var, const Dim key, const Variable &begin,
+               const Variable &end) {
+  return slice_bins(var, key, begin, end, false);
+}
+
+DataArray slice(const DataArray &array, const Dim key, const Variable &begin,
+                const Variable &end) {
+  return DataArray(slice(array.data(), key, begin, end), array.coords(),
+                   array.masks(), array.attrs(), array.name());
+}
+
+/// Return binned data with the contents of every bin restricted to elements
+/// with `key` in the half-open interval [begin, end), as a view.
+///
+/// The bins must be sorted by `key`, see `sorted_by` and `sort`. The bin
+/// ranges are found by binary search and the result shares the buffer of
+/// `var`, i.e., modifying the bin contents of the result modifies `var`. Throws
+/// if the bins are not sorted by `key`.
+Variable slice_view(const Variable &var, const Dim key, const Variable &begin,
+                    const Variable &end) {
+  return slice_bins(var, key, begin, end, true);
+}
+
+DataArray slice_view(const DataArray &array, const Dim key,
+                     const Variable &begin, const Variable &end) {
+  return DataArray(slice_view(array.data(), key, begin, end), array.coords(),
+                   array.masks(), array.attrs(), array.name());
+}
+
 Variable histogram(const Variable &data, const Variable &binEdges) {
   using namespace scipp::core;
   auto hist_dim = binEdges.dims().inner();
@@ -312,11 +732,12 @@ Variable histogram(const Variable &data, const Variable &binEdges) {
   if (indices.dims().contains(hist_dim))
     indices = indices.rename_dims({{hist_dim, dummy}});
   const auto masked = masked_data(buffer, dim);
-  auto hist = variable::transform_subspan(
-      buffer.dtype(), hist_dim, binEdges.dims()[hist_dim] - 1,
-      subspan_view(buffer.meta()[hist_dim], dim, indices),
-      subspan_view(masked, dim, indices), binEdges, element::histogram,
-      "histogram");
+  auto hist = visit_histogram_kernel(binEdges, hist_dim, [&](const auto &op) {
+    return variable::transform_subspan(
+        buffer.dtype(), hist_dim, binEdges.dims()[hist_dim] - 1,
+        subspan_view(buffer.meta()[hist_dim], dim, indices),
+        subspan_view(masked, dim, indices), binEdges, op, "histogram");
+  });
   if (hist.dims().contains(dummy))
     return sum(hist, dummy);
   else
@@ -334,11 +755,12 @@ Variable map(const DataArray &function, const Variable &x, Dim dim,
         "Function used as lookup table in map operation must be a histogram");
   const auto data = masked_data(function, dim, fill);
   const auto weights = subspan_view(data, dim);
-  if (all(islinspace(edges, dim)).value<bool>()) {
+  const auto kind = edge_kind(edges, dim);
+  if (kind == variable::EdgeKind::Linspace) {
     return variable::transform(x, subspan_view(edges, dim), weights, fill,
                                core::element::event::map_linspace, "map");
   } else {
-    if (!allsorted(edges, dim))
+    if (kind == variable::EdgeKind::Unsorted)
       throw except::BinEdgeError("Bin edges of histogram must be sorted.");
     return variable::transform(x, subspan_view(edges, dim), weights, fill,
                                core::element::event::map_sorted_edges, "map");
@@ -357,12 +779,13 @@ void scale(DataArray &array, const DataArray &histogram, Dim dim) {
   const auto &edges = histogram.meta()[dim];
   const auto masked = masked_data(histogram, dim);
   const auto weights = subspan_view(masked, dim);
-  if (all(islinspace(edges, dim)).value<bool>()) {
+  const auto kind = edge_kind(edges, dim);
+  if (kind == variable::EdgeKind::Linspace) {
     transform_in_place(data, coord, subspan_view(edges, dim), weights,
                        core::element::event::map_and_mul_linspace,
                        "bins.scale");
   } else {
-    if (!allsorted(edges, dim))
+    if (kind == variable::EdgeKind::Unsorted)
       throw except::BinEdgeError("Bin edges of histogram must be sorted.");
     transform_in_place(data, coord, subspan_view(edges, dim), weights,
                        core::element::event::map_and_mul_sorted_edges,
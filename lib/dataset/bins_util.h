@@ -4,11 +4,30 @@
 /// @author Simon Heybrock
 #pragma once
 
+#include "scipp/core/element/histogram.h"
+#include "scipp/core/except.h"
 #include "scipp/dataset/bins.h"
 #include "scipp/variable/util.h"
 
 namespace scipp::dataset {
 
+/// Mark the contents of all bins of `var` as sorted by `key`, see
+/// `buckets::sorted_by`. This makes the key coord of the buffer read-only.
+void set_sorted_by(Variable &var, const Dim key);
+
+/// Return true if the buffer rows between and after the bins of `var` may be
+/// filled in place, see `BinArrayModel::has_capacity`.
+bool has_capacity(const Variable &var);
+void set_has_capacity(Variable &var, const bool has_capacity);
+
+/// Return true if the bin indices of `var` are not shared with any other
+/// variable, such as the indices passed to `make_bins` or a `bins_view`.
+bool has_unique_bin_indices(const Variable &var);
+/// Replace the bin indices of `var` in its underlying model by `indices`.
+///
+/// Other variables sharing the previous indices are not affected.
+void set_bin_indices(Variable &var, const Variable &indices);
+
 template <class Masks>
 Variable hide_masked(const Variable &data, const Masks &masks,
                      const scipp::span<const Dim> dims) {
@@ -24,4 +43,19 @@ Variable hide_masked(const Variable &data, const Masks &masks,
   return make_bins_no_validate(indices, buffer_dim, buffer);
 }
 
+/// Call `f` with the histogram kernel matching the kind of `edges`.
+///
+/// The edges are inspected once here instead of once per output histogram.
+template <class F>
+auto visit_histogram_kernel(const Variable &edges, const Dim dim, F &&f) {
+  switch (variable::edge_kind(edges, dim)) {
+  case variable::EdgeKind::Linspace:
+    return f(core::element::histogram_linspace);
+  case variable::EdgeKind::Sorted:
+    return f(core::element::histogram_sorted_edges);
+  default:
+    throw except::BinEdgeError("Bin edges of histogram must be sorted.");
+  }
+}
+
 } // namespace scipp::dataset
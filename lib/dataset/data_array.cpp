@@ -126,10 +126,35 @@ Coords DataArray::meta() const {
   return out;
 }
 
+namespace {
+/// Data and metadata of a DataArray, allocated as a single block.
+struct DataArrayBlock {
+  Variable data;
+  Coords coords;
+  Masks masks;
+  Attrs attrs;
+};
+} // namespace
+
+/// Return a slice of the data array.
+///
+/// Slices of valid items are inserted into the sliced dicts without further
+/// validation, and data and dicts of the slice share a single allocation, to
+/// keep the cost low when creating many slices, e.g., in a loop over spectra.
 DataArray DataArray::slice(const Slice &s) const {
-  auto [coords, attrs] = m_coords->slice_coords(s);
-  auto out = DataArray{m_data->slice(s), std::move(coords), m_masks->slice(s),
-                       m_attrs->slice(s).merge_from(attrs), m_name};
+  auto [coords, unaligned] = m_coords->slice_coords(s);
+  auto attrs = m_attrs->slice(s);
+  if (!unaligned.empty())
+    attrs = attrs.merge_from(unaligned);
+  auto block = std::make_shared<DataArrayBlock>(
+      DataArrayBlock{m_data->slice(s), std::move(coords), m_masks->slice(s),
+                     std::move(attrs)});
+  DataArray out;
+  out.m_name = m_name;
+  out.m_data = std::shared_ptr<Variable>(block, &block->data);
+  out.m_coords = std::shared_ptr<Coords>(block, &block->coords);
+  out.m_masks = std::shared_ptr<Masks>(block, &block->masks);
+  out.m_attrs = std::shared_ptr<Attrs>(block, &block->attrs);
   out.m_readonly = true;
   return out;
 }
@@ -137,4 +137,10 @@ template <class T, class Func> DataArray transform(const T &a, Func func) {
 masked_data(const DataArray &array, const Dim dim,
             const std::optional<Variable> &fill_value = std::nullopt);
 
+/// Like `extract_by_indices`, but without checking that the indices are in
+/// range. For indices computed internally, e.g., by sorting.
+template <class T>
+T extract_by_indices_unchecked(const Variable &indices, const T &data,
+                               const Dim dim);
+
 } // namespace scipp::dataset
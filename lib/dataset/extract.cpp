@@ -2,8 +2,11 @@
 // Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
 /// @file
 /// @author Simon Heybrock
+#include <algorithm>
 #include <numeric>
 
+#include "scipp/core/gather.h"
+#include "scipp/core/tag_util.h"
 #include "scipp/variable/variable_factory.h"
 
 #include "scipp/dataset/bins.h"
@@ -11,6 +14,8 @@
 #include "scipp/dataset/extract.h"
 #include "scipp/dataset/util.h"
 
+#include "dataset_operations_common.h"
+
 namespace scipp {
 
 namespace {
@@ -85,6 +90,164 @@ T extract_ranges(const Variable &indices, const T &data, const Dim dim) {
   return transform_data(out, dense_or_copy_bin_elements, no_edges);
 }
 
+namespace {
+template <class Index> struct GatherContiguous {
+  template <class T> struct With {
+    static void apply(const Variable &in, Variable &out, const Index *indices,
+                      const scipp::index nindex, const scipp::index size,
+                      const scipp::index outer, const scipp::index inner) {
+      core::gather(in.values<T>().data(), out.values<T>().data(), indices,
+                   nindex, size, outer, inner);
+      if (in.has_variances())
+        core::gather(in.variances<T>().data(), out.variances<T>().data(),
+                     indices, nindex, size, outer, inner);
+    }
+  };
+};
+
+template <class... Ts> bool has_dtype(const DType type) {
+  return ((type == dtype<Ts>) || ...);
+}
+
+template <class... Ts, class Index>
+Variable gather_dense(const Variable &var, const Dim dim,
+                      const Index *indices, const scipp::index nindex) {
+  if (!has_dtype<Ts...>(var.dtype())) {
+    // Fallback for dtypes without a gather kernel: Length-1 ranges.
+    auto ranges = makeVariable<scipp::index_pair>(Dims{dim}, Shape{nindex});
+    std::transform(indices, indices + nindex,
+                   ranges.values<scipp::index_pair>().begin(),
+                   [](const auto i) { return scipp::index_pair{i, i + 1}; });
+    return extract_ranges(ranges, var, dim);
+  }
+  const auto &in_dims = var.dims();
+  const auto size = in_dims[dim];
+  scipp::index outer = 1;
+  scipp::index inner = 1;
+  for (scipp::index i = 0; i < in_dims.ndim(); ++i)
+    if (i < in_dims.index(dim))
+      outer *= in_dims.size(i);
+    else if (i > in_dims.index(dim))
+      inner *= in_dims.size(i);
+  const auto contiguous =
+      Strides(var.strides()) == Strides(in_dims) ? var : copy(var);
+  auto dims = in_dims;
+  dims.resize(dim, nindex);
+  Variable out(var, dims);
+  core::CallDType<Ts...>::template apply<
+      GatherContiguous<Index>::template With>(
+      var.dtype(), contiguous, out, indices, nindex, size, outer, inner);
+  return out;
+}
+
+template <class Index>
+Variable gather(const Variable &var, const Dim dim, const Index *indices,
+                const scipp::index nindex) {
+  if (!var.dims().contains(dim))
+    return copy(var);
+  if (is_bins(var)) {
+    // Gather the bin indices, then copy the selected bins from the buffer.
+    const auto bin_indices =
+        gather_dense<scipp::index_pair>(var.bin_indices(), dim, indices,
+                                        nindex);
+    return copy_ranges_from_bins_buffer(bin_indices, var);
+  }
+  return gather_dense<double, float, int64_t, int32_t, bool, core::time_point,
+                      std::string, scipp::index_pair>(var, dim, indices,
+                                                      nindex);
+}
+
+template <class Index, class T>
+T extract_by_indices_impl(const Variable &indices, const T &data,
+                          const Dim dim) {
+  const auto values = indices.values<Index>();
+  const auto *first = values.data();
+  const auto n = indices.dims().volume();
+  const auto func = [&](const Variable &var) {
+    return gather(var, dim, first, n);
+  };
+  if constexpr (std::is_same_v<T, Variable>) {
+    return func(data);
+  } else if constexpr (std::is_same_v<T, DataArray>) {
+    return dataset::transform(strip_edges_along(data, dim), func);
+  } else {
+    const auto no_edges = strip_edges_along(data, dim);
+    Dataset out;
+    for (const auto &[d, coord] : no_edges.coords())
+      out.setCoord(d, func(coord));
+    for (const auto &item : no_edges) {
+      using dataset::transform_map;
+      using MaskMap = dataset::Masks::holder_type;
+      using AttrMap = dataset::Attrs::holder_type;
+      out.setData(item.name(),
+                  DataArray(func(item.data()), {},
+                            transform_map<MaskMap>(item.masks(), func),
+                            transform_map<AttrMap>(item.attrs(), func),
+                            item.name()));
+    }
+    return out;
+  }
+}
+} // namespace
+
+namespace {
+void expect_valid_indices(const Variable &indices) {
+  if (indices.dims().ndim() != 1)
+    throw except::DimensionError("Indices must be 1-D, got " +
+                                 to_string(indices.dims()) + '.');
+  if (indices.dtype() != dtype<int64_t> && indices.dtype() != dtype<int32_t>)
+    throw except::TypeError("Indices must have dtype int64 or int32, got " +
+                            to_string(indices.dtype()) + '.');
+}
+
+template <class Index>
+void expect_indices_in_range(const Variable &indices, const scipp::index size) {
+  const auto values = indices.values<Index>().as_span();
+  if (values.empty())
+    return;
+  const auto [min, max] = std::minmax_element(values.begin(), values.end());
+  if (*min < 0 || *max >= size)
+    throw except::SliceError(
+        "Indices must be in [0, " + std::to_string(size) + "), got " +
+        std::to_string(*min < 0 ? *min : *max) + '.');
+}
+} // namespace
+
+namespace dataset {
+template <class T>
+T extract_by_indices_unchecked(const Variable &indices, const T &data,
+                               const Dim dim) {
+  expect_valid_indices(indices);
+  if (indices.dim() != dim)
+    throw except::DimensionError("Indices must be 1-D along dimension " +
+                                 to_string(dim) + ", got " +
+                                 to_string(indices.dims()) + '.');
+  if (Strides(indices.strides()) != Strides(indices.dims()))
+    return extract_by_indices_unchecked(copy(indices), data, dim);
+  if (indices.dtype() == dtype<int64_t>)
+    return extract_by_indices_impl<int64_t>(indices, data, dim);
+  return extract_by_indices_impl<int32_t>(indices, data, dim);
+}
+
+template Variable extract_by_indices_unchecked(const Variable &,
+                                               const Variable &, const Dim);
+template DataArray extract_by_indices_unchecked(const Variable &,
+                                                const DataArray &, const Dim);
+template Dataset extract_by_indices_unchecked(const Variable &,
+                                              const Dataset &, const Dim);
+} // namespace dataset
+
+template <class T>
+T extract_by_indices(const Variable &indices, const T &data, const Dim dim) {
+  expect_valid_indices(indices);
+  const auto size = data.dims()[dim];
+  if (indices.dtype() == dtype<int64_t>)
+    expect_indices_in_range<int64_t>(indices, size);
+  else
+    expect_indices_in_range<int32_t>(indices, size);
+  return dataset::extract_by_indices_unchecked(indices, data, dim);
+}
+
 namespace {
 template <class T> T extract_impl(const T &obj, const Variable &condition) {
   if (condition.dtype() != dtype<bool>)
@@ -111,6 +274,21 @@ template <class T> T extract_impl(const T &obj, const Variable &condition) {
     else if (i != 0) // falling edge
       indices.back().second = i;
   }
+  scipp::index selected = 0;
+  for (const auto &[begin, end] : indices)
+    selected += end - begin;
+  // Many short runs are gathered more efficiently as individual indices.
+  if (selected < 4 * scipp::size(indices)) {
+    std::vector<scipp::index> flat;
+    flat.reserve(selected);
+    for (const auto &[begin, end] : indices)
+      for (scipp::index i = begin; i < end; ++i)
+        flat.push_back(i);
+    return dataset::extract_by_indices_unchecked(
+        makeVariable<scipp::index>(Dims{condition.dim()}, Shape{selected},
+                                   Values(std::move(flat))),
+        obj, condition.dim());
+  }
   return extract_ranges(makeVariable<scipp::index_pair>(Dims{condition.dim()},
                                                         Shape{indices.size()},
                                                         Values(indices)),
@@ -139,5 +317,14 @@ template SCIPP_DATASET_EXPORT DataArray extract_ranges(const Variable &,
 template SCIPP_DATASET_EXPORT Dataset extract_ranges(const Variable &,
                                                      const Dataset &,
                                                      const Dim);
+template SCIPP_DATASET_EXPORT Variable extract_by_indices(const Variable &,
+                                                          const Variable &,
+                                                          const Dim);
+template SCIPP_DATASET_EXPORT DataArray extract_by_indices(const Variable &,
+                                                           const DataArray &,
+                                                           const Dim);
+template SCIPP_DATASET_EXPORT Dataset extract_by_indices(const Variable &,
+                                                         const Dataset &,
+                                                         const Dim);
 
 } // namespace scipp
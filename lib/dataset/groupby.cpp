@@ -5,6 +5,7 @@
 #include <numeric>
 
 #include "scipp/core/bucket.h"
+#include "scipp/core/element/arithmetic.h"
 #include "scipp/core/element/comparison.h"
 #include "scipp/core/element/logical.h"
 #include "scipp/core/histogram.h"
@@ -14,6 +15,8 @@
 #include "scipp/variable/accumulate.h"
 #include "scipp/variable/cumulative.h"
 #include "scipp/variable/operations.h"
+#include "scipp/variable/shape.h"
+#include "scipp/variable/transform.h"
 #include "scipp/variable/util.h"
 #include "scipp/variable/variable_factory.h"
 
@@ -68,13 +71,180 @@ T GroupBy<T>::makeReductionOutput(const Dim reductionDim,
 }
 
 namespace {
-template <class Op, class Groups>
-void reduce_(Op op, const Dim reductionDim, const Variable &out_data,
-             const DataArray &data, const Dim dim, const Groups &groups,
+/// Return the index of the group of each slice, or -1 for slices that are not
+/// in any group.
+std::vector<scipp::index>
+make_group_indices(const std::vector<GroupByGrouping::group> &groups,
+                   const scipp::index size) {
+  std::vector<scipp::index> indices(size, -1);
+  core::parallel::parallel_for(
+      core::parallel::blocked_range(0, scipp::size(groups)),
+      [&](const auto &range) {
+        for (auto group = range.begin(); group != range.end(); ++group)
+          for (const auto &slice : groups[group])
+            std::fill(indices.begin() + slice.begin(),
+                      indices.begin() + slice.end(), group);
+      });
+  return indices;
+}
+
+/// Element kernel for reducing all groups in a single pass over the data.
+///
+/// Applies to dense data with one of the element types `Ts`. If `PromoteFloat`
+/// is set float data is accumulated in double, as in variable::sum_into.
+template <class Kernel, bool PromoteFloat, class... Ts> struct GroupsKernel {
+  Kernel kernel;
+};
+
+template <bool PromoteFloat, class... Ts, class Kernel>
+constexpr auto groups_kernel(Kernel kernel) {
+  return GroupsKernel<Kernel, PromoteFloat, Ts...>{kernel};
+}
+
+template <class T, bool Variances, class Var>
+auto contiguous_elements(Var &var) {
+  if constexpr (Variances)
+    return variable::detail::ContiguousValuesAndVariances{
+        var.template values<T>().data(), var.template variances<T>().data()};
+  else
+    return variable::detail::ContiguousValues{var.template values<T>().data()};
+}
+
+/// Accumulate rows [begin, end) of `in` into the rows of `out` given by the
+/// group indices. Both are contiguous with `stride` elements per row.
+template <class Kernel, class Out, class In>
+void reduce_rows(const Kernel &kernel, const Out &out, const In &in,
+                 const scipp::index begin, const scipp::index end,
+                 const std::vector<scipp::index> &group_indices,
+                 const scipp::index stride) {
+  for (scipp::index row = begin; row < end; ++row) {
+    const auto group = group_indices[row];
+    if (group < 0)
+      continue;
+    for (scipp::index i = 0; i < stride; ++i) {
+      auto &&x = out.get(group * stride + i);
+      kernel(x, in.get(row * stride + i));
+      out.set(group * stride + i, x);
+    }
+  }
+}
+
+template <class Acc, class T, bool Variances, class Kernel>
+void reduce_groups_impl(const Kernel &kernel, Variable &accum,
+                        const Variable &rows,
+                        const std::vector<scipp::index> &group_indices) {
+  const auto nrow = scipp::size(group_indices);
+  if (nrow == 0)
+    return;
+  const auto ngroup = accum.dims().size(0);
+  const auto stride = rows.dims().volume() / nrow;
+  // Rows are split into chunks, each accumulated into a private copy of the
+  // output. This is only worth it if there are many rows per group. The chunks
+  // depend only on the shape, not on the number of threads, such that results
+  // for floating-point data are reproducible.
+  constexpr scipp::index min_elements_per_chunk = 65536;
+  constexpr scipp::index max_chunks = 64;
+  const auto nchunk = std::max<scipp::index>(
+      1, std::min({max_chunks, nrow / std::max<scipp::index>(ngroup, 1),
+                   nrow * stride / min_elements_per_chunk}));
+  std::vector<Variable> partials;
+  for (scipp::index chunk = 1; chunk < nchunk; ++chunk)
+    partials.emplace_back(copy(accum));
+  const auto in = contiguous_elements<T, Variances>(rows);
+  core::parallel::parallel_for(
+      core::parallel::blocked_range(0, nchunk, 1), [&](const auto &range) {
+        for (auto chunk = range.begin(); chunk != range.end(); ++chunk)
+          reduce_rows(kernel,
+                      contiguous_elements<Acc, Variances>(
+                          chunk == 0 ? accum : partials[chunk - 1]),
+                      in, nrow * chunk / nchunk, nrow * (chunk + 1) / nchunk,
+                      group_indices, stride);
+      });
+  const auto out = contiguous_elements<Acc, Variances>(accum);
+  for (const auto &partial : partials) {
+    const auto part = contiguous_elements<Acc, Variances>(partial);
+    core::parallel::parallel_for(
+        core::parallel::blocked_range_by_work(0, accum.dims().volume(),
+                                              2 * sizeof(Acc)),
+        [&](const auto &range) {
+          for (auto i = range.begin(); i != range.end(); ++i) {
+            auto &&x = out.get(i);
+            kernel(x, part.get(i));
+            out.set(i, x);
+          }
+        },
+        core::parallel::static_partitioner{});
+  }
+}
+
+/// Reduce all groups with a single pass over the data.
+///
+/// In contrast to applying the reduction operation to every slice of every
+/// group this does not depend on the order of the keys, i.e., on how many
+/// slices the groups consist of. Returns false if the data is not supported,
+/// e.g., binned data or data for which the reduction changes the dtype.
+template <class Kernel, bool PromoteFloat, class... Ts>
+bool reduce_groups(const GroupsKernel<Kernel, PromoteFloat, Ts...> &kernel,
+                   const Dim reductionDim, const Variable &out_data,
+                   const Variable &data, const Variable &mask,
+                   const Variable &mask_replacement, const Dim dim,
+                   const std::vector<scipp::index> &group_indices) {
+  if (data.dtype() != out_data.dtype() ||
+      data.has_variances() != out_data.has_variances() ||
+      !((data.dtype() == dtype<Ts>) || ...) ||
+      !data.dims().contains(reductionDim) ||
+      scipp::size(group_indices) != data.dims()[reductionDim])
+    return false;
+  std::vector<Dim> order{reductionDim};
+  for (const auto &label : data.dims().labels())
+    if (label != reductionDim)
+      order.push_back(label);
+  auto rows = transpose(
+      mask.is_valid() ? where(mask, mask_replacement, data) : data, order);
+  if (Strides(rows.strides()) != Strides(rows.dims()))
+    rows = copy(rows);
+  order.front() = dim;
+  auto out = transpose(out_data, order);
+  const auto reduce_as = [&](auto tag) {
+    using T = decltype(tag);
+    using Acc = std::conditional_t<PromoteFloat && std::is_same_v<T, float>,
+                                   double, T>;
+    auto accum = astype(out, core::dtype<Acc>);
+    if (data.has_variances()) {
+      if constexpr (core::canHaveVariances<T>())
+        reduce_groups_impl<Acc, T, true>(kernel.kernel, accum, rows,
+                                         group_indices);
+    } else {
+      reduce_groups_impl<Acc, T, false>(kernel.kernel, accum, rows,
+                                        group_indices);
+    }
+    copy(astype(accum, core::dtype<T>, CopyPolicy::TryAvoid), out);
+    return true;
+  };
+  return ((data.dtype() == dtype<Ts> && reduce_as(Ts{})) || ...);
+}
+
+template <class Op, class Kernel, class Groups>
+void reduce_(Op op, const Kernel &kernel, const Dim reductionDim,
+             const Variable &out_data, const DataArray &data, const Dim dim,
+             const Groups &groups,
+             const std::vector<scipp::index> &group_indices,
              const FillValue fill) {
   const auto mask_replacement =
       special_like(Variable(data.data(), Dimensions{}), fill);
   auto mask = irreducible_mask(data.masks(), reductionDim);
+  if (!groups.empty() && data.dims().contains(reductionDim)) {
+    // Run the regular operation on an empty slice such that units, dtypes,
+    // and variances are checked in the same way as for the per-slice path.
+    auto out_slice = out_data.slice({dim, 0});
+    const auto empty = Slice(reductionDim, 0, 0);
+    op(out_slice, mask.is_valid() ? where(mask.slice(empty), mask_replacement,
+                                          data.data().slice(empty))
+                                  : data.data().slice(empty));
+    if (reduce_groups(kernel, reductionDim, out_data, data.data(), mask,
+                      mask_replacement, dim, group_indices))
+      return;
+  }
   const auto process = [&](const auto &range) {
     // Apply to each group, storing result in output slice
     for (scipp::index group = range.begin(); group != range.end(); ++group) {
@@ -94,16 +264,24 @@ void reduce_(Op op, const Dim reductionDim, const Variable &out_data,
 } // namespace
 
 template <class T>
-template <class Op>
-T GroupBy<T>::reduce(Op op, const Dim reductionDim,
+template <class Op, class Kernel>
+T GroupBy<T>::reduce(Op op, const Kernel &kernel, const Dim reductionDim,
                      const FillValue fill) const {
   auto out = makeReductionOutput(reductionDim, fill);
+  // Computed once for all items of a dataset, but not kept in the grouping
+  // since it has the length of the grouped dimension.
+  const auto group_indices =
+      m_grouping.sliceDim() == reductionDim &&
+              m_data.dims().contains(reductionDim)
+          ? make_group_indices(groups(), m_data.dims()[reductionDim])
+          : std::vector<scipp::index>{};
   if constexpr (std::is_same_v<T, Dataset>) {
     for (const auto &item : m_data)
-      reduce_(op, reductionDim, out[item.name()].data(), item, dim(), groups(),
-              fill);
+      reduce_(op, kernel, reductionDim, out[item.name()].data(), item, dim(),
+              groups(), group_indices, fill);
   } else {
-    reduce_(op, reductionDim, out.data(), m_data, dim(), groups(), fill);
+    reduce_(op, kernel, reductionDim, out.data(), m_data, dim(), groups(),
+            group_indices, fill);
   }
   return out;
 }
@@ -127,42 +305,64 @@ template <class T> T GroupBy<T>::concat(const Dim reductionDim) const {
 
 /// Reduce each group using `sum` and return combined data.
 template <class T> T GroupBy<T>::sum(const Dim reductionDim) const {
-  return reduce(variable::sum_into, reductionDim, FillValue::ZeroNotBool);
+  return reduce(variable::sum_into,
+                groups_kernel<true, double, float, int64_t, int32_t>(
+                    core::element::add_equals),
+                reductionDim, FillValue::ZeroNotBool);
 }
 
 /// Reduce each group using `nansum` and return combined data.
 template <class T> T GroupBy<T>::nansum(const Dim reductionDim) const {
-  return reduce(variable::nansum_into, reductionDim, FillValue::ZeroNotBool);
+  return reduce(variable::nansum_into,
+                groups_kernel<true, double, float, int64_t, int32_t>(
+                    core::element::nan_add_equals),
+                reductionDim, FillValue::ZeroNotBool);
 }
 
 /// Reduce each group using `all` and return combined data.
 template <class T> T GroupBy<T>::all(const Dim reductionDim) const {
-  return reduce(variable::all_into, reductionDim, FillValue::True);
+  return reduce(variable::all_into,
+                groups_kernel<false, bool>(core::element::logical_and_equals),
+                reductionDim, FillValue::True);
 }
 
 /// Reduce each group using `any` and return combined data.
 template <class T> T GroupBy<T>::any(const Dim reductionDim) const {
-  return reduce(variable::any_into, reductionDim, FillValue::False);
+  return reduce(variable::any_into,
+                groups_kernel<false, bool>(core::element::logical_or_equals),
+                reductionDim, FillValue::False);
 }
 
 /// Reduce each group using `max` and return combined data.
 template <class T> T GroupBy<T>::max(const Dim reductionDim) const {
-  return reduce(variable::max_into, reductionDim, FillValue::Lowest);
+  return reduce(variable::max_into,
+                groups_kernel<false, double, float, int64_t, int32_t>(
+                    core::element::max_equals),
+                reductionDim, FillValue::Lowest);
 }
 
 /// Reduce each group using `nanmax` and return combined data.
 template <class T> T GroupBy<T>::nanmax(const Dim reductionDim) const {
-  return reduce(variable::nanmax_into, reductionDim, FillValue::Lowest);
+  return reduce(variable::nanmax_into,
+                groups_kernel<false, double, float, int64_t, int32_t>(
+                    core::element::nanmax_equals),
+                reductionDim, FillValue::Lowest);
 }
 
 /// Reduce each group using `min` and return combined data.
 template <class T> T GroupBy<T>::min(const Dim reductionDim) const {
-  return reduce(variable::min_into, reductionDim, FillValue::Max);
+  return reduce(variable::min_into,
+                groups_kernel<false, double, float, int64_t, int32_t>(
+                    core::element::min_equals),
+                reductionDim, FillValue::Max);
 }
 
 /// Reduce each group using `nanmin` and return combined data.
 template <class T> T GroupBy<T>::nanmin(const Dim reductionDim) const {
-  return reduce(variable::nanmin_into, reductionDim, FillValue::Max);
+  return reduce(variable::nanmin_into,
+                groups_kernel<false, double, float, int64_t, int32_t>(
+                    core::element::nanmin_equals),
+                reductionDim, FillValue::Max);
 }
 
 /// Apply mean to groups and return combined data.
@@ -180,12 +380,20 @@ template <class T> T GroupBy<T>::mean(const Dim reductionDim) const {
     auto scale = makeVariable<double>(Dims{dim()}, Shape{size()});
     const auto scaleT = scale.template values<double>();
     const auto mask = irreducible_mask(data.masks(), reductionDim);
+    // Count masked elements directly if the mask is 1-D to avoid the overhead
+    // of calling `sum` for every slice.
+    const bool count_masked = mask.is_valid() && mask.dims().ndim() == 1 &&
+                              m_grouping.sliceDim() == reductionDim;
     for (scipp::index group = 0; group < size(); ++group)
       for (const auto &slice : groups()[group]) {
         // N contributing to each slice
         scaleT[group] += slice.end() - slice.begin();
         // N masks for each slice, that need to be subtracted
-        if (mask.is_valid()) {
+        if (count_masked) {
+          const auto masked = mask.template values<bool>();
+          for (scipp::index i = slice.begin(); i < slice.end(); ++i)
+            scaleT[group] -= masked[i];
+        } else if (mask.is_valid()) {
           const auto masks_sum = variable::sum(mask.slice(slice), reductionDim);
           scaleT[group] -= masks_sum.template value<int64_t>();
         }
@@ -237,43 +445,89 @@ template <class T> struct nan_sensitive_equal {
 } // namespace
 
 template <class T> struct MakeGroups {
+  using Map = std::unordered_map<T, GroupByGrouping::group, std::hash<T>,
+                                 nan_sensitive_equal<T>>;
+
   static GroupByGrouping apply(const Variable &key, const Dim targetDim) {
     expect::is_key(key);
     const auto &values = key.values<T>();
 
     const auto dim = key.dim();
-    std::unordered_map<T, GroupByGrouping::group, std::hash<T>,
-                       nan_sensitive_equal<T>>
-        indices;
-    const auto end = values.end();
-    scipp::index i = 0;
-    for (auto it = values.begin(); it != end;) {
-      // Use contiguous (thick) slices if possible to avoid overhead of slice
-      // handling in follow-up "apply" steps.
-      const auto begin = i;
-      const auto &group_value = *it;
-      while (it != end && nan_sensitive_equal<T>()(*it, group_value)) {
-        ++it;
-        ++i;
-      }
-      indices[group_value].emplace_back(dim, begin, i);
-    }
+    const auto size = scipp::size(values);
+    // The key is split into chunks that are hashed in parallel, each into one
+    // map per hash partition. The maps of each partition are then merged in
+    // parallel, such that no step touches all distinct keys serially.
+    constexpr scipp::index min_chunk_size = 16384;
+    const auto nchunk = std::clamp<scipp::index>(
+        size / min_chunk_size, 1, core::parallel::max_concurrency());
+    const auto npartition = nchunk;
+    const auto partition = [npartition](const T &value) {
+      return static_cast<scipp::index>(std::hash<T>{}(value) %
+                                       static_cast<size_t>(npartition));
+    };
+    std::vector<std::vector<Map>> chunks(nchunk, std::vector<Map>(npartition));
+    core::parallel::parallel_for(
+        core::parallel::blocked_range(0, nchunk, 1), [&](const auto &range) {
+          for (auto chunk = range.begin(); chunk != range.end(); ++chunk) {
+            auto &maps = chunks[chunk];
+            scipp::index i = size * chunk / nchunk;
+            const auto end_index = size * (chunk + 1) / nchunk;
+            auto it = values.begin() + i;
+            const auto end = values.begin() + end_index;
+            while (it != end) {
+              // Use contiguous (thick) slices if possible to avoid overhead of
+              // slice handling in follow-up "apply" steps.
+              const auto begin = i;
+              const auto &group_value = *it;
+              while (it != end &&
+                     nan_sensitive_equal<T>()(*it, group_value)) {
+                ++it;
+                ++i;
+              }
+              maps[partition(group_value)][group_value].emplace_back(dim, begin,
+                                                                     i);
+            }
+          }
+        });
+
+    std::vector<Map> partitions(npartition);
+    core::parallel::parallel_for(
+        core::parallel::blocked_range(0, npartition, 1),
+        [&](const auto &range) {
+          for (auto part = range.begin(); part != range.end(); ++part) {
+            auto &merged = partitions[part];
+            // Chunks are merged in order, so slices remain sorted.
+            for (auto &maps : chunks)
+              for (auto &[value, slices] : maps[part]) {
+                auto &group = merged[value];
+                auto first = slices.begin();
+                // Join runs that were split at a chunk boundary.
+                if (!group.empty() && group.back().end() == first->begin()) {
+                  group.back() = Slice(dim, group.back().begin(), first->end());
+                  ++first;
+                }
+                group.insert(group.end(), first, slices.end());
+              }
+          }
+        });
 
     std::vector<T> keys;
-    std::vector<GroupByGrouping::group> groups;
-    keys.reserve(scipp::size(indices));
-    groups.reserve(scipp::size(indices));
-    for (auto &item : indices)
-      keys.emplace_back(item.first);
+    for (const auto &merged : partitions)
+      for (const auto &item : merged)
+        keys.emplace_back(item.first);
     core::parallel::parallel_sort(keys.begin(), keys.end(),
                                   NanSensitiveLess<T>());
-    for (const auto &k : keys) {
-      // false positive, fixed in https://github.com/danmar/cppcheck/pull/4230
-      // cppcheck-suppress containerOutOfBounds
-      groups.emplace_back(std::move(indices.at(k)));
-    }
-
-    const Dimensions dims{targetDim, scipp::size(indices)};
+    std::vector<GroupByGrouping::group> groups(keys.size());
+    core::parallel::parallel_for(
+        core::parallel::blocked_range(0, scipp::size(keys)),
+        [&](const auto &range) {
+          for (auto i = range.begin(); i != range.end(); ++i) {
+            const auto &k = keys[i];
+            groups[i] = std::move(partitions[partition(k)].at(k));
+          }
+        });
+
+    const Dimensions dims{targetDim, scipp::size(keys)};
     auto keys_ = makeVariable<T>(Dimensions{dims}, Values(std::move(keys)));
     keys_.setUnit(key.unit());
     return {dim, std::move(keys_), std::move(groups)};
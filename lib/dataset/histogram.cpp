@@ -66,12 +66,14 @@ DataArray histogram(const DataArray &events, const Variable &binEdges) {
           // out of scope, leading to subtle bugs. Here on the other hand the
           // returned temporary is kept alive until the end of the
           // full-expression.
-          return transform_subspan(
-              events_.dtype(), dim, binEdges_.dims()[dim] - 1,
-              subspan_view(as_contiguous(events_.coords()[dim], event_dim_),
-                           event_dim_),
-              subspan_view(as_contiguous(data, event_dim_), event_dim_),
-              binEdges_, element::histogram, "histogram");
+          return visit_histogram_kernel(binEdges_, dim, [&](const auto &op) {
+            return transform_subspan(
+                events_.dtype(), dim, binEdges_.dims()[dim] - 1,
+                subspan_view(as_contiguous(events_.coords()[dim], event_dim_),
+                             event_dim_),
+                subspan_view(as_contiguous(data, event_dim_), event_dim_),
+                binEdges_, op, "histogram");
+          });
         },
         event_dim, binEdges);
   } else {
@@ -4,10 +4,16 @@
 /// @author Simon Heybrock
 #pragma once
 
+#include <memory>
+
 #include "scipp/dataset/dataset.h"
 
 namespace scipp::dataset {
 
+namespace bin_detail {
+class TargetBinBuilder;
+}
+
 SCIPP_DATASET_EXPORT DataArray bin(const DataArray &array,
                                    const std::vector<Variable> &edges,
                                    const std::vector<Variable> &groups = {},
@@ -20,4 +26,33 @@ SCIPP_DATASET_EXPORT DataArray bin(const Variable &data, const Coords &coords,
                                    const std::vector<Variable> &groups = {},
                                    const std::vector<Dim> &erase = {});
 
+/// Reusable setup for binning many tables with the same edges and groups.
+///
+/// Edges are validated and group lookup maps as well as the kind of edges
+/// (linspace or not) are computed only once on construction, instead of on
+/// every call to `bin`.
+class SCIPP_DATASET_EXPORT BinPlan {
+public:
+  explicit BinPlan(const std::vector<Variable> &edges,
+                   const std::vector<Variable> &groups = {});
+
+  [[nodiscard]] const Dimensions &dims() const noexcept;
+  [[nodiscard]] const std::vector<Variable> &edges() const noexcept {
+    return m_edges;
+  }
+  [[nodiscard]] const std::vector<Variable> &groups() const noexcept {
+    return m_groups;
+  }
+
+  [[nodiscard]] Variable target_bins(const DataArray &table) const;
+  [[nodiscard]] DataArray apply(const DataArray &table) const;
+  [[nodiscard]] DataArray apply(const DataArray &table,
+                                const Variable &target_bins) const;
+
+private:
+  std::vector<Variable> m_edges;
+  std::vector<Variable> m_groups;
+  std::shared_ptr<const bin_detail::TargetBinBuilder> m_builder;
+};
+
 } // namespace scipp::dataset
@@ -56,6 +56,30 @@ namespace scipp::dataset::buckets {
 
 SCIPP_DATASET_EXPORT void append(Variable &var0, const Variable &var1);
 SCIPP_DATASET_EXPORT void append(DataArray &a, const DataArray &b);
+SCIPP_DATASET_EXPORT void compact(Variable &var);
+SCIPP_DATASET_EXPORT void compact(DataArray &array);
+
+[[nodiscard]] SCIPP_DATASET_EXPORT Variable sort(const Variable &var,
+                                                 const Dim key);
+[[nodiscard]] SCIPP_DATASET_EXPORT DataArray sort(const DataArray &array,
+                                                  const Dim key);
+[[nodiscard]] SCIPP_DATASET_EXPORT std::optional<Dim>
+sorted_by(const Variable &var);
+[[nodiscard]] SCIPP_DATASET_EXPORT Variable slice(const Variable &var,
+                                                  const Dim key,
+                                                  const Variable &begin,
+                                                  const Variable &end);
+[[nodiscard]] SCIPP_DATASET_EXPORT DataArray slice(const DataArray &array,
+                                                   const Dim key,
+                                                   const Variable &begin,
+                                                   const Variable &end);
+[[nodiscard]] SCIPP_DATASET_EXPORT Variable slice_view(const Variable &var,
+                                                       const Dim key,
+                                                       const Variable &begin,
+                                                       const Variable &end);
+[[nodiscard]] SCIPP_DATASET_EXPORT DataArray
+slice_view(const DataArray &array, const Dim key, const Variable &begin,
+           const Variable &end);
 
 [[nodiscard]] SCIPP_DATASET_EXPORT Variable histogram(const Variable &data,
                                                       const Variable &binEdges);
@@ -12,6 +12,15 @@ template <class T>
 [[nodiscard]] T extract_ranges(const Variable &indices, const T &data,
                                const Dim dim);
 
+/// Return the slices of `data` along `dim` given by a 1-D array of indices.
+///
+/// `indices` must have dtype int64 or int32, be in the range [0, size) of
+/// `dim`, and may contain repeated indices. Data, coords, masks, and attrs
+/// depending on `dim` are gathered, bin-edges along `dim` are dropped.
+template <class T>
+[[nodiscard]] T extract_by_indices(const Variable &indices, const T &data,
+                                   const Dim dim);
+
 SCIPP_DATASET_EXPORT Variable extract(const Variable &var,
                                       const Variable &condition);
 SCIPP_DATASET_EXPORT DataArray extract(const DataArray &da,
@@ -60,8 +60,9 @@ public:
 
 private:
   T makeReductionOutput(const Dim reductionDim, const FillValue fill) const;
-  template <class Op>
-  T reduce(Op op, const Dim reductionDim, const FillValue fill) const;
+  template <class Op, class Kernel>
+  T reduce(Op op, const Kernel &kernel, const Dim reductionDim,
+           const FillValue fill) const;
 
   T m_data;
   GroupByGrouping m_grouping;
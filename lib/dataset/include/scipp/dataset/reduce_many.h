@@ -0,0 +1,17 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+#pragma once
+
+#include <vector>
+
+#include "scipp/dataset/dataset.h"
+#include "scipp/variable/reduction.h"
+
+namespace scipp::dataset {
+
+SCIPP_DATASET_EXPORT std::vector<DataArray>
+reduce_many(const DataArray &a, const Dim dim,
+            const std::vector<Reduction> &reductions);
+
+} // namespace scipp::dataset
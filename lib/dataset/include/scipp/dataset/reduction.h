@@ -0,0 +1,21 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+#pragma once
+
+/*
+ * Reductions with options, in addition to the generated reduction functions.
+ */
+
+#include "scipp/dataset/dataset.h"
+#include "scipp/variable/reduction.h"
+
+namespace scipp::dataset {
+
+[[nodiscard]] SCIPP_DATASET_EXPORT DataArray sum(const DataArray &a,
+                                                 const SumMode mode);
+[[nodiscard]] SCIPP_DATASET_EXPORT DataArray sum(const DataArray &a,
+                                                 const Dim dim,
+                                                 const SumMode mode);
+
+} // namespace scipp::dataset
@@ -14,31 +14,35 @@
 #include "scipp/variable/variable.h"
 
 namespace scipp::dataset {
+/// Return the slice of a single item of a dict with given sizes.
+template <class Value>
+Value slice_item(const Sizes &sizes, const Value &value, const Slice &params) {
+  if (value.dims().contains(params.dim())) {
+    if (value.dims()[params.dim()] == sizes[params.dim()])
+      return value.slice(params);
+    // bin edge
+    if (params.stride() != 1)
+      throw except::SliceError(
+          "Object has bin-edges along dimension " + to_string(params.dim()) +
+          " so slicing with stride " + std::to_string(params.stride()) +
+          " != 1 is not valid.");
+    const auto end = params.end() == -1               ? params.begin() + 2
+                     : params.begin() == params.end() ? params.end()
+                                                      : params.end() + 1;
+    return value.slice(Slice{params.dim(), params.begin(), end});
+  } else if (params == Slice{}) {
+    return value;
+  } else {
+    return value.as_const();
+  }
+}
+
 template <class Mapping>
 Mapping slice_map(const Sizes &sizes, const Mapping &map, const Slice &params) {
   Mapping out;
-  for (const auto &[key, value] : map) {
-    if (value.dims().contains(params.dim())) {
-      if (value.dims()[params.dim()] == sizes[params.dim()]) {
-        out.insert_or_assign(key, value.slice(params));
-      } else { // bin edge
-        if (params.stride() != 1)
-          throw except::SliceError(
-              "Object has bin-edges along dimension " +
-              to_string(params.dim()) + " so slicing with stride " +
-              std::to_string(params.stride()) + " != 1 is not valid.");
-        const auto end = params.end() == -1               ? params.begin() + 2
-                         : params.begin() == params.end() ? params.end()
-                                                          : params.end() + 1;
-        out.insert_or_assign(
-            key, value.slice(Slice{params.dim(), params.begin(), end}));
-      }
-    } else if (params == Slice{}) {
-      out.insert_or_assign(key, value);
-    } else {
-      out.insert_or_assign(key, value.as_const());
-    }
-  }
+  out.reserve(map.size());
+  for (const auto &[key, value] : map)
+    out.insert_or_assign(key, slice_item(sizes, value, params));
   return out;
 }
 
@@ -144,6 +148,13 @@ public:
   bool is_edges(const Key &key, std::optional<Dim> dim = std::nullopt) const;
 
 protected:
+  /// Tag for constructing from items that are known to be valid for the
+  /// sizes, e.g., slices of the items of a valid dict.
+  struct Unchecked {};
+  SizedDict(Unchecked, Sizes sizes, holder_type items, bool readonly) noexcept
+      : m_sizes(std::move(sizes)), m_items(std::move(items)),
+        m_readonly(readonly) {}
+
   Sizes m_sizes;
   holder_type m_items;
   bool m_readonly{false};
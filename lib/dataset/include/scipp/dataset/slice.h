@@ -4,6 +4,8 @@
 /// @author Owen Arnold
 #pragma once
 
+#include <vector>
+
 #include "scipp/dataset/dataset.h"
 
 namespace scipp::dataset {
@@ -40,4 +42,10 @@ get_slice_params(const Dataset &data, const Dim dim, const Variable &begin,
                                                  const Variable &begin,
                                                  const Variable &end);
 
+[[nodiscard]] SCIPP_DATASET_EXPORT std::vector<DataArray>
+slices(const DataArray &data, const std::vector<Slice> &params);
+
+[[nodiscard]] SCIPP_DATASET_EXPORT std::vector<DataArray>
+slices(const DataArray &data, const Dim dim);
+
 } // namespace scipp::dataset
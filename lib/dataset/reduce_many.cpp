@@ -0,0 +1,26 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+#include "scipp/dataset/reduce_many.h"
+
+#include "dataset_operations_common.h"
+
+namespace scipp::dataset {
+
+/// Compute several reductions of a data array along `dim` in a single pass.
+///
+/// Masked elements are ignored, as in the individual reductions. The results
+/// are returned in the order given by `reductions`, with coords, masks, and
+/// attrs depending on `dim` dropped.
+std::vector<DataArray> reduce_many(const DataArray &a, const Dim dim,
+                                   const std::vector<Reduction> &reductions) {
+  const auto data = variable::reduce_many(a.data(), dim, reductions,
+                                          irreducible_mask(a.masks(), dim));
+  std::vector<DataArray> results;
+  for (const auto &var : data)
+    results.emplace_back(apply_to_data_and_drop_dim(
+        a, [&var](auto &&...) { return var; }, dim));
+  return results;
+}
+
+} // namespace scipp::dataset
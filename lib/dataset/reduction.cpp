@@ -0,0 +1,33 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+#include "scipp/dataset/reduction.h"
+#include "scipp/dataset/bins.h"
+#include "scipp/variable/creation.h"
+#include "scipp/variable/util.h"
+
+#include "../variable/operations_common.h"
+#include "dataset_operations_common.h"
+
+namespace scipp::dataset {
+
+DataArray sum(const DataArray &a, const SumMode mode) {
+  return variable::reduce_all_dims(
+      a, [mode](auto &&..._) { return sum(_..., mode); });
+}
+
+/// Return the sum along given dimension using the given summation algorithm,
+/// ignoring masked elements.
+DataArray sum(const DataArray &a, const Dim dim, const SumMode mode) {
+  return apply_to_data_and_drop_dim(
+      a,
+      [mode](const Variable &var, const Dim dim_, const Masks &masks) {
+        if (const auto mask_union = irreducible_mask(masks, dim_);
+            mask_union.is_valid())
+          return sum(where(mask_union, zero_like(var), var), dim_, mode);
+        return sum(var, dim_, mode);
+      },
+      dim, a.masks());
+}
+
+} // namespace scipp::dataset
@@ -37,12 +37,12 @@ SizedDict<Key, Value>::SizedDict(Sizes sizes, holder_type items,
 
 template <class Key, class Value>
 SizedDict<Key, Value>::SizedDict(const SizedDict &other)
-    : SizedDict(other.m_sizes, other.m_items, false) {}
+    : SizedDict(Unchecked{}, other.m_sizes, other.m_items, false) {}
 
 template <class Key, class Value>
 SizedDict<Key, Value>::SizedDict(SizedDict &&other) noexcept
-    : SizedDict(std::move(other.m_sizes), std::move(other.m_items),
-                other.m_readonly) {}
+    : SizedDict(Unchecked{}, std::move(other.m_sizes),
+                std::move(other.m_items), other.m_readonly) {}
 
 template <class Key, class Value>
 SizedDict<Key, Value> &
@@ -221,7 +221,8 @@ Value SizedDict<Key, Value>::extract(const key_type &key,
 template <class Key, class Value>
 SizedDict<Key, Value> SizedDict<Key, Value>::slice(const Slice &params) const {
   const bool readonly = true;
-  return {m_sizes.slice(params), slice_map(m_sizes, m_items, params), readonly};
+  return {Unchecked{}, m_sizes.slice(params),
+          slice_map(m_sizes, m_items, params), readonly};
 }
 
 namespace {
@@ -235,17 +236,27 @@ constexpr auto unaligned_by_dim_slice = [](const auto &coords, const auto &key,
 };
 }
 
+/// Return the slices of coords, and of coords that become unaligned by the
+/// slice, i.e., attrs.
+///
+/// This is a single pass over the items. Slices of valid items are valid for
+/// the sliced sizes, so they are inserted without further checks.
 template <class Key, class Value>
 std::tuple<SizedDict<Key, Value>, SizedDict<Key, Value>>
 SizedDict<Key, Value>::slice_coords(const Slice &params) const {
-  auto coords = slice(params);
-  coords.m_readonly = false;
-  SizedDict<Key, Value> attrs(coords.sizes(), {});
-  for (const auto &[key, var] : *this)
+  const auto sizes = m_sizes.slice(params);
+  holder_type coords;
+  holder_type attrs;
+  coords.reserve(size());
+  for (const auto &[key, var] : *this) {
+    auto sliced = slice_item(m_sizes, var, params);
     if (unaligned_by_dim_slice(*this, key, var, params))
-      attrs.set(key, coords.extract(key));
-  coords.m_readonly = true;
-  return {std::move(coords), std::move(attrs)};
+      attrs.insert_or_assign(key, std::move(sliced));
+    else
+      coords.insert_or_assign(key, std::move(sliced));
+  }
+  return {SizedDict(Unchecked{}, sizes, std::move(coords), true),
+          SizedDict(Unchecked{}, sizes, std::move(attrs), false)};
 }
 
 template <class Key, class Value>
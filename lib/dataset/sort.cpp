@@ -3,9 +3,11 @@
 /// @file
 /// @author Simon Heybrock
 #include "scipp/dataset/sort.h"
-#include "scipp/core/parallel.h"
+#include "scipp/core/gather.h"
+#include "scipp/core/radix_sort.h"
 #include "scipp/core/tag_util.h"
-#include "scipp/dataset/extract.h"
+
+#include "dataset_operations_common.h"
 
 namespace scipp::dataset {
 
@@ -21,35 +23,26 @@ constexpr auto nan_sensitive_less = [](const auto &a, const auto &b) {
 template <class T> struct IndicesForSorting {
   static Variable apply(const Variable &key, const SortOrder order) {
     const auto size = key.dims()[key.dim()];
-    const auto values = key.values<T>();
-    std::vector<std::pair<T, scipp::index>> key_index;
-    key_index.reserve(size);
-
-    {
-      scipp::index i = 0;
-      for (const auto &value : key.values<T>())
-        key_index.emplace_back(value, i++);
+    const auto contiguous =
+        Strides(key.strides()) == Strides(key.dims()) ? key : copy(key);
+    const T *values = contiguous.values<T>().data();
+    std::vector<scipp::index> perm;
+    if constexpr (core::is_radix_sortable_v<T>) {
+      perm = core::radix_argsort<scipp::index>(
+          values, size, order == SortOrder::Descending);
+    } else {
+      const auto get = [values](const scipp::index i) -> const T & {
+        return values[i];
+      };
+      perm = order == SortOrder::Ascending
+                 ? core::argsort<scipp::index>(size, get, nan_sensitive_less)
+                 : core::argsort<scipp::index>(
+                       size, get, [](const auto &a, const auto &b) {
+                         return nan_sensitive_less(b, a);
+                       });
     }
-
-    if (order == SortOrder::Ascending)
-      core::parallel::parallel_sort(
-          key_index.begin(), key_index.end(), [](const auto &a, const auto &b) {
-            return nan_sensitive_less(a.first, b.first);
-          });
-    else
-      core::parallel::parallel_sort(
-          key_index.begin(), key_index.end(), [](const auto &a, const auto &b) {
-            return nan_sensitive_less(b.first, a.first);
-          });
-
-    auto indices =
-        makeVariable<scipp::index_pair>(Dims{key.dim()}, Shape{size});
-    std::transform(key_index.begin(), key_index.end(),
-                   indices.values<scipp::index_pair>().as_span().begin(),
-                   [](const auto &item) {
-                     return std::pair{item.second, item.second + 1};
-                   });
-    return indices;
+    return makeVariable<scipp::index>(Dims{key.dim()}, Shape{size},
+                                      Values(std::move(perm)));
   }
 };
 
@@ -63,13 +56,15 @@ Variable indices_for_sorting(const Variable &key, const SortOrder order) {
 
 /// Return a Variable sorted based on key.
 Variable sort(const Variable &var, const Variable &key, const SortOrder order) {
-  return extract_ranges(indices_for_sorting(key, order), var, key.dim());
+  return extract_by_indices_unchecked(indices_for_sorting(key, order), var,
+                                      key.dim());
 }
 
 /// Return a DataArray sorted based on key.
 DataArray sort(const DataArray &array, const Variable &key,
                const SortOrder order) {
-  return extract_ranges(indices_for_sorting(key, order), array, key.dim());
+  return extract_by_indices_unchecked(indices_for_sorting(key, order), array,
+                                      key.dim());
 }
 
 /// Return a DataArray sorted based on coordinate.
@@ -80,7 +75,8 @@ DataArray sort(const DataArray &array, const Dim &key, const SortOrder order) {
 /// Return a Dataset sorted based on key.
 Dataset sort(const Dataset &dataset, const Variable &key,
              const SortOrder order) {
-  return extract_ranges(indices_for_sorting(key, order), dataset, key.dim());
+  return extract_by_indices_unchecked(indices_for_sorting(key, order), dataset,
+                                      key.dim());
 }
 
 /// Return a Dataset sorted based on coordinate.
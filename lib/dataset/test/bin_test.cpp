@@ -587,6 +587,50 @@ TEST_P(BinTest, error_if_erase_binning_and_try_rebin_along_same_dimension) {
                except::DimensionError);
 }
 
+TEST_P(BinTest, plan_same_as_bin) {
+  const auto table = GetParam();
+  const BinPlan plan({edges_x, edges_y}, {groups});
+  EXPECT_EQ(plan.apply(table), bin(table, {edges_x, edges_y}, {groups}));
+  const BinPlan plan_drop({edges_x.slice({Dim::X, 1, 4})},
+                          {groups.slice({Dim("group"), 1, 4})});
+  EXPECT_EQ(plan_drop.apply(table),
+            bin(table, {edges_x.slice({Dim::X, 1, 4})},
+                {groups.slice({Dim("group"), 1, 4})}));
+}
+
+TEST_P(BinTest, plan_reused_for_many_tables) {
+  const BinPlan plan({edges_x_coarse}, {groups});
+  for (const auto &table : {GetParam(), make_table(100), make_table(0)})
+    EXPECT_EQ(plan.apply(table), bin(table, {edges_x_coarse}, {groups}));
+}
+
+TEST_P(BinTest, plan_apply_with_target_bins) {
+  const auto table = GetParam();
+  const BinPlan plan({edges_x, edges_y});
+  const auto target_bins = plan.target_bins(table);
+  EXPECT_EQ(target_bins.dims(), table.dims());
+  auto other = copy(table);
+  other.setData(table.data() * (2.0 * units::one));
+  EXPECT_EQ(plan.apply(other, target_bins), bin(other, {edges_x, edges_y}));
+  EXPECT_THROW_DISCARD(plan.apply(make_table(3), plan.target_bins(table)),
+                       except::DimensionError);
+}
+
+TEST_P(BinTest, plan_validates_edges_and_input) {
+  const auto table = GetParam();
+  EXPECT_THROW_DISCARD(BinPlan({}), std::invalid_argument);
+  EXPECT_THROW_DISCARD(BinPlan({edges_x.slice({Dim::X, 0, 1})}),
+                       except::BinEdgeError);
+  const BinPlan plan({edges_x});
+  EXPECT_THROW_DISCARD(plan.apply(bin(table, {edges_y})),
+                       except::BinnedDataError);
+  EXPECT_THROW_DISCARD(
+      plan.apply(DataArray(table.data().rename_dims({{Dim::Row, Dim::X}}),
+                           {{Dim::X, table.coords()[Dim::X].rename_dims(
+                                         {{Dim::Row, Dim::X}})}})),
+      except::DimensionError);
+}
+
 TEST(BinTest, twod_not_supported) {
   const Dimensions dims({{Dim::X, 2}, {Dim::Y, 2}});
   const auto data = makeVariable<double>(dims, Values{0, 1, 2, 3});
@@ -2,6 +2,8 @@
 // Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
 #include <gtest/gtest.h>
 
+#include <limits>
+
 #include "test_macros.h"
 
 #include "scipp/dataset/bins.h"
@@ -102,6 +104,284 @@ TEST_F(DataArrayBinsTest, concatenate) {
   buckets::append(var, -var);
 }
 
+TEST_F(DataArrayBinsTest, append_uses_capacity_after_growth) {
+  const auto buffer_size = [](const Variable &v) {
+    return std::get<2>(v.constituents<DataArray>()).dims()[Dim::X];
+  };
+  auto expected = copy(var);
+  buckets::append(var, var);
+  expected = buckets::concatenate(expected, expected);
+  EXPECT_EQ(var, expected);
+  // Reallocation reserves capacity, subsequent small appends fit.
+  const auto capacity = buffer_size(var);
+  EXPECT_GT(capacity, 8);
+  const auto batch = var.slice({Dim::Y, 0, 2}) * (2.0 * units::one);
+  buckets::append(var, batch.slice({Dim::Y, 0, 2}));
+  expected = buckets::concatenate(expected, batch);
+  EXPECT_EQ(var, expected);
+  EXPECT_EQ(buffer_size(var), capacity);
+  buckets::compact(var);
+  EXPECT_EQ(var, expected);
+  EXPECT_EQ(buffer_size(var), 16);
+}
+
+TEST_F(DataArrayBinsTest, append_many_small_batches) {
+  auto expected = copy(var);
+  const auto batch = copy(var.slice({Dim::Y, 0, 2}));
+  scipp::index reallocations = 0;
+  for (scipp::index i = 0; i < 100; ++i) {
+    const auto before = std::get<2>(var.constituents<DataArray>());
+    buckets::append(var, batch);
+    expected = buckets::concatenate(expected, batch);
+    reallocations += !before.data().is_same(
+        std::get<2>(var.constituents<DataArray>()).data());
+  }
+  EXPECT_EQ(var, expected);
+  EXPECT_LT(reallocations, 10);
+}
+
+TEST_F(DataArrayBinsTest, append_does_not_modify_shared_buffer) {
+  // Gaps after bins, as created by `make_bins` with user-provided indices.
+  const auto indices_ = makeVariable<scipp::index_pair>(
+      dims, Values{std::pair{0, 1}, std::pair{2, 3}});
+  auto binned = make_bins(indices_, Dim::X, buffer);
+  const auto original = copy(buffer);
+  const auto original_indices = copy(indices_);
+  buckets::append(binned, copy(binned));
+  EXPECT_EQ(buffer, original);
+  EXPECT_EQ(indices_, original_indices);
+}
+
+TEST_F(DataArrayBinsTest, append_does_not_modify_bins_view) {
+  auto binned = copy(var);
+  buckets::append(binned, copy(binned)); // reallocate, with capacity
+  for (const auto &batch : {copy(binned), copy(var)}) {
+    // Kept alive across the append, shares the bin indices of `binned`.
+    const auto x = bins_view<DataArray>(binned).coords()[Dim::X];
+    const auto original = copy(x);
+    auto expected = buckets::concatenate(binned, batch);
+    buckets::append(binned, batch);
+    EXPECT_EQ(x, original);
+    EXPECT_EQ(binned, expected);
+  }
+}
+
+TEST_F(DataArrayBinsTest, operation_after_append_to_single_bin) {
+  // Indices of a single bin are compact even if the buffer has capacity.
+  auto single = copy(var.slice({Dim::Y, 0, 1}));
+  const auto expected = buckets::concatenate(single, single);
+  buckets::append(single, copy(single));
+  EXPECT_GT(std::get<2>(single.constituents<DataArray>()).dims()[Dim::X], 4);
+  const auto two = 2.0 * units::one;
+  EXPECT_EQ(single * two, expected * two);
+  EXPECT_EQ(copy(single.slice({Dim::Y, 0})) * two,
+            expected.slice({Dim::Y, 0}) * two);
+}
+
+TEST_F(DataArrayBinsTest, compact_slice_throws) {
+  auto slice = var.slice({Dim::Y, 1});
+  EXPECT_THROW(buckets::compact(slice), except::SliceError);
+}
+
+TEST_F(DataArrayBinsTest, sort) {
+  // Bins in reverse buffer order with a gap, sorted by a coord with a NaN.
+  constexpr auto nan = std::numeric_limits<double>::quiet_NaN();
+  const auto indices_ = makeVariable<scipp::index_pair>(
+      dims, Values{std::pair{3, 6}, std::pair{0, 2}});
+  const auto key = makeVariable<double>(
+      Dims{Dim::X}, Shape{6}, Values{2.0, 1.0, 0.0, nan, 5.0, 4.0});
+  const auto data_ = makeVariable<double>(Dims{Dim::X}, Shape{6}, units::m,
+                                          Values{1, 2, 3, 4, 5, 6},
+                                          Variances{1, 2, 3, 4, 5, 6});
+  const auto mask = makeVariable<bool>(
+      Dims{Dim::X}, Shape{6}, Values{true, false, false, false, true, false});
+  const auto unsorted = make_bins(
+      indices_, Dim::X, DataArray(data_, {{Dim::Z, key}}, {{"mask", mask}}));
+  EXPECT_FALSE(buckets::sorted_by(unsorted));
+
+  const auto sorted = buckets::sort(unsorted, Dim::Z);
+  const auto expected = make_bins(
+      makeVariable<scipp::index_pair>(dims,
+                                      Values{std::pair{0, 3}, std::pair{3, 5}}),
+      Dim::X,
+      DataArray(makeVariable<double>(Dims{Dim::X}, Shape{5}, units::m,
+                                     Values{6, 5, 4, 2, 1},
+                                     Variances{6, 5, 4, 2, 1}),
+                {{Dim::Z,
+                  makeVariable<double>(Dims{Dim::X}, Shape{5},
+                                       Values{4.0, 5.0, nan, 1.0, 2.0})}},
+                {{"mask", makeVariable<bool>(
+                              Dims{Dim::X}, Shape{5},
+                              Values{false, true, false, false, true})}}));
+  EXPECT_TRUE(equals_nan(sorted, expected));
+  EXPECT_EQ(buckets::sorted_by(sorted), Dim::Z);
+  EXPECT_EQ(buckets::sorted_by(sorted.slice({Dim::Y, 1})), Dim::Z);
+}
+
+TEST_F(DataArrayBinsTest, sort_data_array) {
+  const DataArray da(var, {{Dim::Y, makeVariable<double>(dims)}});
+  const auto sorted = buckets::sort(da, Dim::X);
+  EXPECT_EQ(sorted, da);
+  EXPECT_EQ(buckets::sorted_by(sorted.data()), Dim::X);
+  EXPECT_FALSE(buckets::sorted_by(da.data()));
+}
+
+TEST_F(DataArrayBinsTest, sort_marker_reset_by_modification) {
+  auto sorted = buckets::sort(var, Dim::X);
+  buckets::append(sorted, var);
+  EXPECT_FALSE(buckets::sorted_by(sorted));
+  sorted = buckets::sort(var, Dim::X);
+  bins_view<DataArray>(sorted).coords().set(
+      Dim::X, bins_view<DataArray>(sorted).data());
+  EXPECT_FALSE(buckets::sorted_by(sorted));
+}
+
+TEST_F(DataArrayBinsTest, sort_key_is_readonly) {
+  auto sorted = buckets::sort(var, Dim::X);
+  auto key = bins_view<DataArray>(sorted).coords()[Dim::X];
+  EXPECT_THROW(key *= -1.0 * units::one, except::VariableError);
+  EXPECT_EQ(sorted, buckets::sort(var, Dim::X));
+  EXPECT_EQ(buckets::sorted_by(sorted), Dim::X);
+  bins_view<DataArray>(sorted).data() *= -1.0 * units::one;
+  EXPECT_EQ(buckets::sorted_by(sorted), Dim::X);
+}
+
+TEST_F(DataArrayBinsTest, sort_marker_tied_to_key_data) {
+  auto sorted = buckets::sort(var, Dim::X);
+  auto &coords = sorted.bin_buffer<DataArray>().coords();
+  const auto key = coords.extract(Dim::X);
+  EXPECT_FALSE(buckets::sorted_by(sorted));
+  coords.set(Dim::X, key);
+  EXPECT_EQ(buckets::sorted_by(sorted), Dim::X);
+  coords.set(Dim::X, copy(key).as_const());
+  EXPECT_FALSE(buckets::sorted_by(sorted));
+  EXPECT_FALSE(buckets::sorted_by(copy(buckets::sort(var, Dim::X))));
+}
+
+TEST_F(DataArrayBinsTest, sort_bad_key) {
+  EXPECT_THROW_DISCARD(buckets::sort(var, Dim::Z), except::NotFoundError);
+  EXPECT_THROW_DISCARD(buckets::sort(bins_view<DataArray>(var).data(), Dim::X),
+                       except::TypeError);
+}
+
+TEST_F(DataArrayBinsTest, slice_sorted_copies) {
+  const auto sorted = buckets::sort(var, Dim::X);
+  const auto result =
+      buckets::slice(sorted, Dim::X, 4.0 * units::one, 7.0 * units::one);
+  const auto expected =
+      make_bins(makeVariable<scipp::index_pair>(
+                    dims, Values{std::pair{0, 1}, std::pair{1, 2}}),
+                Dim::X, copy(buffer.slice({Dim::X, 1, 3})));
+  EXPECT_EQ(result, expected);
+  EXPECT_EQ(buckets::sorted_by(result), Dim::X);
+  EXPECT_EQ(std::get<2>(result.constituents<DataArray>()).dims()[Dim::X], 2);
+}
+
+TEST_F(DataArrayBinsTest, slice_view_shares_buffer) {
+  const auto sorted = buckets::sort(var, Dim::X);
+  const auto result =
+      buckets::slice_view(sorted, Dim::X, 4.0 * units::one, 7.0 * units::one);
+  const auto expected =
+      make_bins(makeVariable<scipp::index_pair>(
+                    dims, Values{std::pair{1, 2}, std::pair{2, 3}}),
+                Dim::X, copy(buffer));
+  EXPECT_EQ(result, expected);
+  EXPECT_EQ(buckets::sorted_by(result), Dim::X);
+  const auto &buffer_of = [](const Variable &v) {
+    return std::get<2>(v.constituents<DataArray>());
+  };
+  EXPECT_TRUE(buffer_of(result).data().is_same(buffer_of(sorted).data()));
+}
+
+TEST_F(DataArrayBinsTest, slice_view_requires_sorted) {
+  EXPECT_THROW_DISCARD(
+      buckets::slice_view(var, Dim::X, 4.0 * units::one, 7.0 * units::one),
+      except::BinnedDataError);
+  auto sorted = buckets::sort(var, Dim::X);
+  bins_view<DataArray>(sorted).coords().set(
+      Dim::X, bins_view<DataArray>(sorted).data());
+  EXPECT_THROW_DISCARD(
+      buckets::slice_view(sorted, Dim::X, 4.0 * units::one, 7.0 * units::one),
+      except::BinnedDataError);
+}
+
+TEST_F(DataArrayBinsTest, slice_unsorted_copies) {
+  const auto result =
+      buckets::slice(var, Dim::X, 4.0 * units::one, 7.0 * units::one);
+  const auto expected_buffer = copy(buffer.slice({Dim::X, 1, 3}));
+  const auto expected =
+      make_bins(makeVariable<scipp::index_pair>(
+                    dims, Values{std::pair{0, 1}, std::pair{1, 2}}),
+                Dim::X, expected_buffer);
+  EXPECT_EQ(result, expected);
+  EXPECT_FALSE(buckets::sorted_by(result));
+}
+
+TEST_F(DataArrayBinsTest, slice_sorted_matches_unsorted) {
+  constexpr auto nan = std::numeric_limits<double>::quiet_NaN();
+  const auto indices_ = makeVariable<scipp::index_pair>(
+      dims, Values{std::pair{3, 6}, std::pair{0, 2}});
+  const auto key = makeVariable<double>(
+      Dims{Dim::X}, Shape{6}, Values{2.0, 1.0, 0.0, nan, 5.0, 4.0});
+  const auto unsorted = make_bins(
+      indices_, Dim::X,
+      DataArray(makeVariable<double>(Dims{Dim::X}, Shape{6},
+                                     Values{1, 2, 3, 4, 5, 6}),
+                {{Dim::Z, key}}));
+  const auto sorted = buckets::sort(unsorted, Dim::Z);
+  const auto inf = std::numeric_limits<double>::infinity() * units::one;
+  for (const auto &[begin, end] :
+       {std::pair{Variable{}, Variable{}}, std::pair{Variable{}, inf},
+        std::pair{1.0 * units::one, 4.5 * units::one},
+        std::pair{4.5 * units::one, Variable{}},
+        std::pair{3.0 * units::one, 1.0 * units::one}}) {
+    const auto from_sorted = buckets::slice(sorted, Dim::Z, begin, end);
+    const auto from_unsorted = buckets::slice(unsorted, Dim::Z, begin, end);
+    EXPECT_TRUE(
+        equals_nan(from_sorted, buckets::sort(from_unsorted, Dim::Z)));
+  }
+  EXPECT_TRUE(equals_nan(
+      buckets::slice(sorted, Dim::Z, Variable{}, Variable{}), sorted));
+  EXPECT_EQ(variable::sum(variable::bin_sizes(
+                buckets::slice(sorted, Dim::Z, Variable{}, inf))),
+            makeVariable<scipp::index>(units::none, Values{4}));
+}
+
+TEST_F(DataArrayBinsTest, slice_data_array) {
+  const DataArray da(buckets::sort(var, Dim::X),
+                     {{Dim::Y, makeVariable<double>(dims)}});
+  const auto result =
+      buckets::slice(da, Dim::X, 4.0 * units::one, 7.0 * units::one);
+  EXPECT_EQ(result.coords(), da.coords());
+  EXPECT_EQ(result.data(), buckets::slice(da.data(), Dim::X, 4.0 * units::one,
+                                          7.0 * units::one));
+}
+
+TEST_F(DataArrayBinsTest, slice_bad_bounds) {
+  EXPECT_THROW_DISCARD(
+      buckets::slice(var, Dim::X, 4.0 * units::m, Variable{}),
+      except::UnitError);
+  EXPECT_THROW_DISCARD(
+      buckets::slice(var, Dim::X, Variable{}, 4.0f * units::one),
+      except::TypeError);
+  EXPECT_THROW_DISCARD(buckets::slice(var, Dim::X, Variable{},
+                                      makeVariable<double>(Dims{Dim::Y},
+                                                           Shape{1})),
+                       except::DimensionError);
+  EXPECT_THROW_DISCARD(buckets::slice(var, Dim::Z, Variable{}, Variable{}),
+                       except::NotFoundError);
+}
+
+TEST_F(DataArrayBinsTest, append_to_slice_does_not_modify_original) {
+  const auto sorted = buckets::sort(var, Dim::X);
+  const auto original = copy(sorted);
+  // The view has gaps after its bins, which are in use by the original.
+  auto view =
+      buckets::slice_view(sorted, Dim::X, Variable{}, 3.0 * units::one);
+  buckets::append(view, view);
+  EXPECT_EQ(sorted, original);
+}
+
 TEST_F(DataArrayBinsTest, concatenate_with_broadcast) {
   auto var2 = copy(var).rename_dims({{Dim::Y, Dim::Z}});
   var2 *= 3.0 * units::one;
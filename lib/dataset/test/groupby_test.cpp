@@ -830,3 +830,138 @@ TEST(GroupbyLargeTest, sum) {
   auto grouped = groupby(da, Dim::Z).sum(Dim::X);
   EXPECT_EQ(sum(grouped), sum(da));
 }
+
+struct GroupbyUnsortedKeyTest : public ::testing::Test {
+  GroupbyUnsortedKeyTest() {
+    da = DataArray(makeVariable<double>(
+        Dimensions{{Dim::X, 6}, {Dim::Y, 2}}, units::m,
+        Values{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12},
+        Variances{1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6}));
+    da.coords().set(Dim("labels"), labels);
+  }
+  Variable labels = makeVariable<int64_t>(Dims{Dim::X}, Shape{6},
+                                          Values{2, 1, 2, 3, 1, 2});
+  DataArray da;
+  Variable key = makeVariable<int64_t>(Dims{Dim("labels")}, Shape{3},
+                                       Values{1, 2, 3});
+
+  DataArray make_expected(const Variable &data) {
+    DataArray expected(data);
+    expected.coords().set(Dim("labels"), key);
+    return expected;
+  }
+};
+
+TEST_F(GroupbyUnsortedKeyTest, sum) {
+  EXPECT_EQ(groupby(da, Dim("labels")).sum(Dim::X),
+            make_expected(makeVariable<double>(
+                Dimensions{{Dim("labels"), 3}, {Dim::Y, 2}}, units::m,
+                Values{12, 14, 17, 20, 7, 8},
+                Variances{7, 7, 10, 10, 4, 4})));
+}
+
+TEST_F(GroupbyUnsortedKeyTest, sum_masked) {
+  da.masks().set("mask",
+                 makeVariable<bool>(Dims{Dim::X}, Shape{6},
+                                    Values{false, false, true, false, true,
+                                           false}));
+  EXPECT_EQ(groupby(da, Dim("labels")).sum(Dim::X),
+            make_expected(makeVariable<double>(
+                Dimensions{{Dim("labels"), 3}, {Dim::Y, 2}}, units::m,
+                Values{3, 4, 12, 14, 7, 8}, Variances{2, 2, 7, 7, 4, 4})));
+  EXPECT_EQ(groupby(da, Dim("labels")).mean(Dim::X),
+            make_expected(makeVariable<double>(
+                Dimensions{{Dim("labels"), 3}, {Dim::Y, 2}}, units::m,
+                Values{3, 4, 6, 7, 7, 8},
+                Variances{2.0, 2.0, 1.75, 1.75, 4.0, 4.0})));
+}
+
+TEST_F(GroupbyUnsortedKeyTest, min_max) {
+  da.data().setVariances(Variable());
+  EXPECT_EQ(groupby(da, Dim("labels")).min(Dim::X),
+            make_expected(makeVariable<double>(
+                Dimensions{{Dim("labels"), 3}, {Dim::Y, 2}}, units::m,
+                Values{3, 4, 1, 2, 7, 8})));
+  EXPECT_EQ(groupby(da, Dim("labels")).max(Dim::X),
+            make_expected(makeVariable<double>(
+                Dimensions{{Dim("labels"), 3}, {Dim::Y, 2}}, units::m,
+                Values{9, 10, 11, 12, 7, 8})));
+}
+
+TEST_F(GroupbyUnsortedKeyTest, reduction_dim_not_outer) {
+  da = transpose(da);
+  EXPECT_EQ(groupby(da, Dim("labels")).sum(Dim::X),
+            transpose(make_expected(makeVariable<double>(
+                Dimensions{{Dim("labels"), 3}, {Dim::Y, 2}}, units::m,
+                Values{12, 14, 17, 20, 7, 8},
+                Variances{7, 7, 10, 10, 4, 4}))));
+}
+
+TEST_F(GroupbyUnsortedKeyTest, int32) {
+  da = DataArray(makeVariable<int32_t>(Dims{Dim::X}, Shape{6}, units::counts,
+                                       Values{1, 2, 3, 4, 5, 6}),
+                 {{Dim("labels"), labels}});
+  EXPECT_EQ(groupby(da, Dim("labels")).sum(Dim::X),
+            make_expected(makeVariable<int32_t>(Dims{Dim("labels")}, Shape{3},
+                                                units::counts,
+                                                Values{7, 10, 4})));
+}
+
+TEST_F(GroupbyUnsortedKeyTest, all_any) {
+  da = DataArray(makeVariable<bool>(Dims{Dim::X}, Shape{6},
+                                    Values{true, true, false, true, false,
+                                           true}),
+                 {{Dim("labels"), labels}});
+  EXPECT_EQ(groupby(da, Dim("labels")).all(Dim::X),
+            make_expected(makeVariable<bool>(Dims{Dim("labels")}, Shape{3},
+                                             Values{false, false, true})));
+  EXPECT_EQ(groupby(da, Dim("labels")).any(Dim::X),
+            make_expected(makeVariable<bool>(Dims{Dim("labels")}, Shape{3},
+                                             Values{true, true, true})));
+}
+
+TEST(GroupbyLargeTest, sum_unsorted) {
+  const scipp::index large = 114688;
+  auto data = broadcast(makeVariable<double>(Values{1}),
+                        {{Dim::X, Dim::Y}, {large, 10}});
+  auto z = makeVariable<int32_t>(Dims{Dim::X}, Shape{large});
+  for (scipp::index i = 0; i < large; ++i)
+    z.values<int32_t>()[i] = (i * 7) % 13;
+  DataArray da(data);
+  da.coords().set(Dim::Z, z);
+  auto grouped = groupby(da, Dim::Z).sum(Dim::X);
+  EXPECT_EQ(sum(grouped), sum(da));
+  EXPECT_EQ(grouped.slice({Dim::Z, 0}).data(),
+            broadcast(makeVariable<double>(Values{double((large + 12) / 13)}),
+                      {Dim::Y, 10}));
+}
+
+TEST(GroupbyLargeTest, string_keys) {
+  const scipp::index large = 114688;
+  std::vector<std::string> labels(large);
+  for (scipp::index i = 0; i < large; ++i)
+    labels[i] = std::to_string((i / 7) % 1000);
+  DataArray da(makeVariable<double>(Dims{Dim::X}, Shape{large}));
+  da.coords().set(Dim("labels"),
+                  makeVariable<std::string>(Dims{Dim::X}, Shape{large},
+                                            Values(labels.begin(),
+                                                   labels.end())));
+  const auto grouped = groupby(da, Dim("labels"));
+  ASSERT_EQ(grouped.size(), 1000);
+  const auto keys = grouped.key().values<std::string>();
+  EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end()));
+  for (scipp::index group = 0; group < grouped.size(); ++group) {
+    scipp::index count = 0;
+    scipp::index previous_end = -1;
+    for (const auto &slice : grouped.groups()[group]) {
+      // Sorted, and runs split between threads are joined.
+      EXPECT_GT(slice.begin(), previous_end);
+      previous_end = slice.end();
+      for (scipp::index i = slice.begin(); i < slice.end(); ++i) {
+        EXPECT_EQ(labels[i], keys[group]);
+        ++count;
+      }
+    }
+    EXPECT_EQ(count, std::count(labels.begin(), labels.end(), keys[group]));
+  }
+}
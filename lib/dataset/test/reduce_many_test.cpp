@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include "scipp/dataset/max.h"
+#include "scipp/dataset/mean.h"
+#include "scipp/dataset/min.h"
+#include "scipp/dataset/reduce_many.h"
+#include "scipp/dataset/sum.h"
+
+using namespace scipp;
+
+class ReduceManyTest : public ::testing::Test {
+protected:
+  ReduceManyTest() {
+    a.coords().set(Dim::X, makeVariable<double>(Dims{Dim::X}, Shape{3},
+                                                Values{1, 2, 3}));
+    a.coords().set(Dim::Y,
+                   makeVariable<double>(Dims{Dim::Y}, Shape{2}, Values{1, 2}));
+  }
+
+  void expect_matches_individual(const Dim dim) {
+    const auto results =
+        reduce_many(a, dim,
+                    {Reduction::Sum, Reduction::Mean, Reduction::Min,
+                     Reduction::Max, Reduction::Count});
+    ASSERT_EQ(results.size(), 5);
+    EXPECT_EQ(results[0], sum(a, dim));
+    EXPECT_EQ(results[1], mean(a, dim));
+    EXPECT_EQ(results[2], min(a, dim));
+    EXPECT_EQ(results[3], max(a, dim));
+    EXPECT_EQ(results[4].coords(), sum(a, dim).coords());
+    EXPECT_EQ(results[4].masks(), sum(a, dim).masks());
+  }
+
+  DataArray a{makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 3}, units::m,
+                                   Values{1, 2, 3, 4, 5, 6},
+                                   Variances{1, 2, 3, 4, 5, 6})};
+};
+
+TEST_F(ReduceManyTest, no_mask) {
+  expect_matches_individual(Dim::X);
+  expect_matches_individual(Dim::Y);
+}
+
+TEST_F(ReduceManyTest, irreducible_mask) {
+  a.masks().set("mask", makeVariable<bool>(Dims{Dim::X}, Shape{3},
+                                           Values{false, true, false}));
+  expect_matches_individual(Dim::X);
+  expect_matches_individual(Dim::Y);
+  EXPECT_EQ(reduce_many(a, Dim::X, {Reduction::Count})[0].data(),
+            makeVariable<int64_t>(Dims{Dim::Y}, Shape{2}, units::none,
+                                  Values{2, 2}));
+}
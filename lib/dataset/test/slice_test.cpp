@@ -9,6 +9,7 @@
 #include "scipp/core/except.h"
 #include "scipp/core/slice.h"
 #include "scipp/dataset/dataset.h"
+#include "scipp/dataset/slice.h"
 #include "scipp/variable/arithmetic.h"
 #include "test_macros.h"
 
@@ -673,3 +674,56 @@ TEST(SliceWithStrideTest, works_if_bin_edges_along_unrelated_dim) {
   Slice params(Dim::Y, 0, 4, 2);
   EXPECT_NO_THROW_DISCARD(da.slice(params));
 }
+
+class SlicesTest : public ::testing::Test {
+protected:
+  DataArray da{
+      makeVariable<double>(Dims{Dim::X, Dim::Y}, Shape{3, 2},
+                           Values{1, 2, 3, 4, 5, 6}),
+      {{Dim::X, makeVariable<double>(Dims{Dim::X}, Shape{3}, Values{1, 2, 3})},
+       {Dim::Y, makeVariable<double>(Dims{Dim::Y}, Shape{3}, Values{1, 2, 3})},
+       {Dim::Z, makeVariable<double>(Values{1})}},
+      {{"mask", makeVariable<bool>(Dims{Dim::X}, Shape{3},
+                                   Values{true, false, true})}},
+      {{Dim::Time, makeVariable<double>(Dims{Dim::X}, Shape{3})}}};
+};
+
+TEST_F(SlicesTest, matches_slice) {
+  const std::vector<Slice> params{{Dim::X, 1}, {Dim::Y, 0, 2}, {Dim::Y, 1}};
+  const auto result = slices(da, params);
+  ASSERT_EQ(result.size(), params.size());
+  for (size_t i = 0; i < params.size(); ++i) {
+    EXPECT_EQ(result[i], da.slice(params[i]));
+    EXPECT_TRUE(result[i].is_readonly());
+  }
+}
+
+TEST_F(SlicesTest, all_indices_along_dim) {
+  const auto result = slices(da, Dim::X);
+  ASSERT_EQ(result.size(), 3);
+  for (scipp::index i = 0; i < 3; ++i) {
+    EXPECT_EQ(result[i], da.slice({Dim::X, i}));
+    EXPECT_TRUE(result[i].attrs().contains(Dim::X));
+    EXPECT_FALSE(result[i].coords().contains(Dim::X));
+    EXPECT_TRUE(result[i].data().is_same(da.data().slice({Dim::X, i})));
+  }
+  EXPECT_TRUE(slices(da.slice({Dim::X, 0, 0}), Dim::X).empty());
+}
+
+TEST_F(SlicesTest, invalid_slice_throws) {
+  EXPECT_THROW_DISCARD(slices(da, Dim::Time), except::DimensionError);
+  EXPECT_THROW_DISCARD(slices(da, {Slice{Dim::X, 0}, Slice{Dim::X, 3}}),
+                       except::SliceError);
+}
+
+TEST_F(SlicesTest, sliced_metadata_can_be_extended) {
+  const auto slice = da.slice({Dim::X, 1});
+  const auto &coords = slice.coords();
+  EXPECT_TRUE(coords.is_readonly());
+  Coords copied(coords);
+  EXPECT_FALSE(copied.is_readonly());
+  copied.set(Dim::Row, makeVariable<double>(Dims{Dim::Y}, Shape{2}));
+  EXPECT_THROW(copied.set(Dim::Row, makeVariable<double>(Dims{Dim::X},
+                                                         Shape{3})),
+               except::DimensionError);
+}
@@ -3,7 +3,15 @@
 #include "test_macros.h"
 #include <gtest/gtest.h>
 
+#include <numeric>
+
+#include "scipp/core/parallel.h"
+#include "scipp/dataset/bins.h"
+#include "scipp/dataset/extract.h"
 #include "scipp/dataset/sort.h"
+#include "scipp/variable/astype.h"
+#include "scipp/variable/bins.h"
+#include "scipp/variable/shape.h"
 
 using namespace scipp;
 using namespace scipp::dataset;
@@ -179,3 +187,162 @@ TEST(SortTest, dataset_1d_descending) {
 
   EXPECT_EQ(sort(d, key, SortOrder::Descending), expected);
 }
+
+TEST(SortTest, variable_1d_stable) {
+  const auto var =
+      makeVariable<int>(Dims{Dim::X}, Shape{5}, Values{1, 2, 3, 4, 5});
+  const auto key =
+      makeVariable<double>(Dims{Dim::X}, Shape{5}, Values{1, 0, 1, 0, 1});
+  EXPECT_EQ(sort(var, key), makeVariable<int>(Dims{Dim::X}, Shape{5},
+                                              Values{2, 4, 1, 3, 5}));
+  EXPECT_EQ(sort(var, key, SortOrder::Descending),
+            makeVariable<int>(Dims{Dim::X}, Shape{5}, Values{1, 3, 5, 2, 4}));
+}
+
+TEST(SortTest, variable_2d_transposed) {
+  const auto var = makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 3},
+                                        Values{1, 2, 3, 4, 5, 6});
+  const auto key =
+      makeVariable<int>(Dims{Dim::X}, Shape{3}, Values{10, 20, -1});
+  EXPECT_EQ(sort(transpose(var), key), transpose(sort(var, key)));
+}
+
+TEST(SortTest, variable_1d_large_matches_single_thread) {
+  const scipp::index size = 100000;
+  std::vector<double> values(size);
+  for (scipp::index i = 0; i < size; ++i)
+    values[i] = static_cast<double>((i * 7919) % 1009);
+  const auto key = makeVariable<double>(Dims{Dim::X}, Shape{size},
+                                        Values(values.begin(), values.end()));
+  std::vector<int64_t> iota(size);
+  std::iota(iota.begin(), iota.end(), 0);
+  const auto var = makeVariable<int64_t>(Dims{Dim::X}, Shape{size},
+                                         Values(iota.begin(), iota.end()));
+  const auto sorted = sort(var, key);
+  {
+    core::parallel::ThreadLimit limit(1);
+    EXPECT_EQ(sort(var, key), sorted);
+  }
+  const auto perm = sorted.values<int64_t>();
+  for (scipp::index i = 1; i < size; ++i)
+    ASSERT_TRUE(values[perm[i - 1]] < values[perm[i]] ||
+                (values[perm[i - 1]] == values[perm[i]] &&
+                 perm[i - 1] < perm[i]));
+}
+
+TEST(SortTest, data_array_2d_with_edges) {
+  const auto data = makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 3},
+                                         Values{1, 2, 3, 4, 5, 6});
+  const auto x =
+      makeVariable<double>(Dims{Dim::X}, Shape{3}, Values{3, 1, 2});
+  const auto y_edges =
+      makeVariable<double>(Dims{Dim::Y}, Shape{3}, Values{0, 1, 2});
+  const auto x_edges =
+      makeVariable<double>(Dims{Dim::X}, Shape{4}, Values{0, 1, 2, 3});
+  const DataArray da(data,
+                     {{Dim::X, x}, {Dim::Y, y_edges}, {Dim("xe"), x_edges}});
+  const DataArray expected(
+      makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 3},
+                           Values{2, 3, 1, 5, 6, 4}),
+      {{Dim::X, makeVariable<double>(Dims{Dim::X}, Shape{3}, Values{1, 2, 3})},
+       {Dim::Y, y_edges}});
+  EXPECT_EQ(sort(da, Dim::X), expected);
+}
+
+TEST(SortTest, binned) {
+  const auto indices = makeVariable<scipp::index_pair>(
+      Dims{Dim::Y}, Shape{3}, Values{std::pair{0, 2}, std::pair{2, 2},
+                                     std::pair{2, 5}});
+  const auto buffer = makeVariable<double>(Dims{Dim::X}, Shape{5},
+                                           Values{1, 2, 3, 4, 5});
+  const auto var = make_bins(indices, Dim::X, buffer);
+  const auto key = makeVariable<int>(Dims{Dim::Y}, Shape{3}, Values{2, 1, 0});
+  const auto expected_indices = makeVariable<scipp::index_pair>(
+      Dims{Dim::Y}, Shape{3}, Values{std::pair{0, 3}, std::pair{3, 3},
+                                     std::pair{3, 5}});
+  const auto expected_buffer = makeVariable<double>(Dims{Dim::X}, Shape{5},
+                                                    Values{3, 4, 5, 1, 2});
+  EXPECT_EQ(sort(var, key),
+            make_bins(expected_indices, Dim::X, expected_buffer));
+}
+
+TEST(ExtractByIndicesTest, repeated_indices) {
+  const auto data = makeVariable<double>(Dims{Dim::X}, Shape{3}, units::m,
+                                         Values{1, 2, 3}, Variances{4, 5, 6});
+  const auto mask =
+      makeVariable<bool>(Dims{Dim::X}, Shape{3}, Values{true, false, false});
+  const auto scalar = makeVariable<double>(Values{1.1});
+  const DataArray da(data, {{Dim("scalar"), scalar}}, {{"mask", mask}});
+  const auto indices =
+      makeVariable<int32_t>(Dims{Dim::X}, Shape{4}, Values{2, 0, 0, 1});
+  const DataArray expected(
+      makeVariable<double>(Dims{Dim::X}, Shape{4}, units::m,
+                           Values{3, 1, 1, 2}, Variances{6, 4, 4, 5}),
+      {{Dim("scalar"), scalar}},
+      {{"mask", makeVariable<bool>(Dims{Dim::X}, Shape{4},
+                                   Values{false, true, true, false})}});
+  const auto result = extract_by_indices(indices, da, Dim::X);
+  EXPECT_EQ(result, expected);
+  // Masks are copied, not shared with the input.
+  EXPECT_FALSE(result.masks()["mask"].is_same(mask));
+  EXPECT_EQ(extract_by_indices(astype(indices, dtype<int64_t>), da, Dim::X),
+            expected);
+}
+
+TEST(ExtractByIndicesTest, bad_indices) {
+  const auto var = makeVariable<double>(Dims{Dim::X}, Shape{3});
+  EXPECT_THROW_DISCARD(
+      extract_by_indices(makeVariable<double>(Dims{Dim::X}, Shape{1}), var,
+                         Dim::X),
+      except::TypeError);
+  EXPECT_THROW_DISCARD(
+      extract_by_indices(makeVariable<int64_t>(Dims{Dim::Y}, Shape{1}), var,
+                         Dim::X),
+      except::DimensionError);
+}
+
+TEST(ExtractByIndicesTest, indices_out_of_range) {
+  const auto var = makeVariable<double>(Dims{Dim::X}, Shape{3});
+  for (const int64_t i : {int64_t{-1}, int64_t{3}})
+    EXPECT_THROW_DISCARD(
+        extract_by_indices(makeVariable<int64_t>(Dims{Dim::X}, Shape{2},
+                                                 Values{int64_t{0}, i}),
+                           var, Dim::X),
+        except::SliceError);
+  EXPECT_THROW_DISCARD(
+      extract_by_indices(makeVariable<int32_t>(Dims{Dim::X}, Shape{1},
+                                               Values{int32_t{3}}),
+                         var, Dim::X),
+      except::SliceError);
+  EXPECT_EQ(extract_by_indices(makeVariable<int64_t>(Dims{Dim::X}, Shape{0}),
+                               var, Dim::X),
+            var.slice({Dim::X, 0, 0}));
+}
+
+TEST(ExtractTest, short_runs_match_ranges) {
+  const auto data = makeVariable<double>(Dims{Dim::X, Dim::Y}, Shape{6, 2},
+                                         Values{1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
+                                                11, 12});
+  const auto x = makeVariable<double>(Dims{Dim::X}, Shape{6},
+                                      Values{1, 2, 3, 4, 5, 6});
+  const DataArray da(data, {{Dim::X, x}});
+  const auto condition = makeVariable<bool>(
+      Dims{Dim::X}, Shape{6}, Values{true, false, true, false, false, true});
+  const auto ranges = makeVariable<scipp::index_pair>(
+      Dims{Dim::X}, Shape{3},
+      Values{std::pair{0, 1}, std::pair{2, 3}, std::pair{5, 6}});
+  EXPECT_EQ(extract(da, condition), extract_ranges(ranges, da, Dim::X));
+}
+
+TEST(SortTest, variable_1d_time_point_key) {
+  const auto var =
+      makeVariable<int>(Dims{Dim::X}, Shape{4}, Values{1, 2, 3, 4});
+  const auto key = makeVariable<core::time_point>(
+      Dims{Dim::X}, Shape{4},
+      Values{core::time_point{30}, core::time_point{-10}, core::time_point{30},
+             core::time_point{0}});
+  EXPECT_EQ(sort(var, key),
+            makeVariable<int>(Dims{Dim::X}, Shape{4}, Values{2, 4, 1, 3}));
+  EXPECT_EQ(sort(var, key, SortOrder::Descending),
+            makeVariable<int>(Dims{Dim::X}, Shape{4}, Values{1, 3, 4, 2}));
+}
@@ -6,6 +6,7 @@
 
 #include "scipp/dataset/bins.h"
 #include "scipp/dataset/mean.h"
+#include "scipp/dataset/reduction.h"
 #include "scipp/dataset/sum.h"
 #include "scipp/variable/reduction.h"
 #include "scipp/variable/special_values.h"
@@ -35,6 +36,17 @@ TEST(SumTest, masked_data_array) {
   EXPECT_NE(summedY.masks()["mask"], mask);
 }
 
+TEST(SumTest, masked_data_array_deterministic) {
+  const auto var = makeVariable<double>(Dimensions{{Dim::Y, 2}, {Dim::X, 2}},
+                                        units::m, Values{1.0, 2.0, 3.0, 4.0});
+  DataArray a(var);
+  a.masks().set("mask", makeVariable<bool>(Dimensions{Dim::X, 2},
+                                           Values{false, true}));
+  EXPECT_EQ(sum(a, Dim::X, SumMode::Deterministic), sum(a, Dim::X));
+  EXPECT_EQ(sum(a, Dim::Y, SumMode::Deterministic), sum(a, Dim::Y));
+  EXPECT_EQ(sum(a, SumMode::Deterministic), sum(a));
+}
+
 TEST(SumTest, masked_data_with_special_vals) {
   const auto var = makeVariable<double>(
       Dimensions{{Dim::Y, 2}, {Dim::X, 2}}, units::m,
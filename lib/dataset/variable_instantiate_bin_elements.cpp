@@ -9,6 +9,8 @@
 #include "scipp/variable/bins.h"
 #include "scipp/variable/string.h"
 
+#include "bins_util.h"
+
 namespace scipp::variable {
 
 INSTANTIATE_BIN_ARRAY_VARIABLE(DatasetView, Dataset)
@@ -40,12 +42,19 @@ private:
             .dims()) // would need to select and copy slices from source coords
       throw std::runtime_error(
           "Shape changing operations with bucket<DataArray> not supported yet");
-    // TODO This may also fail if the input buffer has extra capacity (rows not
-    // in any bucket).
+    if (parent.bin_indices() != indices || source.dims()[dim] != dims[dim]) {
+      // Input buffer has extra capacity (rows not in any bin), e.g., after
+      // `buckets::append`, or bins are not in buffer order. Copy only rows
+      // referenced by bins, in the order of the output bins.
+      auto buffer = resize_default_init(source, dim, dims[dim]);
+      copy_slices(source, buffer, dim, parent.bin_indices(), indices);
+      buffer.setData(
+          variable::variableFactory().create(type, dims, unit, variances));
+      return make_bins(copy(indices), dim, std::move(buffer));
+    }
     auto buffer = DataArray(
         variable::variableFactory().create(type, dims, unit, variances),
         copy(source.coords()), copy(source.masks()), copy(source.attrs()));
-    // TODO is the copy needed?
     return make_bins(copy(indices), dim, std::move(buffer));
   }
   const Variable &data(const Variable &var) const override {
@@ -108,6 +117,90 @@ class BinVariableMakerDataset
   }
 };
 
+namespace {
+template <class T> auto &bin_model(const Variable &var) {
+  return variable::requireT<const variable::BinArrayModel<T>>(var.data());
+}
+template <class T> auto &bin_model(Variable &var) {
+  return variable::requireT<variable::BinArrayModel<T>>(var.data());
+}
+template <class Buffer> auto &key_dict(Buffer &buffer, const Dim key) {
+  return buffer.coords().contains(key) ? buffer.coords() : buffer.attrs();
+}
+} // namespace
+
+void set_sorted_by(Variable &var, const Dim key) {
+  auto &model = bin_model<DataArray>(var);
+  // Replace the item in place instead of via `set`, which would be a no-op
+  // for a variable with the same data, and which would change the order.
+  auto &coord = key_dict(model.buffer(), key).find(key)->second;
+  coord = coord.as_const();
+  model.set_sorted_by(key, coord.data_handle());
+}
+
+bool has_capacity(const Variable &var) {
+  if (var.dtype() == dtype<bucket<Variable>>)
+    return bin_model<Variable>(var).has_capacity();
+  else if (var.dtype() == dtype<bucket<DataArray>>)
+    return bin_model<DataArray>(var).has_capacity();
+  else
+    return bin_model<Dataset>(var).has_capacity();
+}
+
+void set_has_capacity(Variable &var, const bool has_capacity) {
+  if (var.dtype() == dtype<bucket<Variable>>)
+    bin_model<Variable>(var).set_has_capacity(has_capacity);
+  else if (var.dtype() == dtype<bucket<DataArray>>)
+    bin_model<DataArray>(var).set_has_capacity(has_capacity);
+  else
+    bin_model<Dataset>(var).set_has_capacity(has_capacity);
+}
+
+bool has_unique_bin_indices(const Variable &var) {
+  if (var.dtype() == dtype<bucket<Variable>>)
+    return bin_model<Variable>(var).indices().use_count() == 1;
+  else if (var.dtype() == dtype<bucket<DataArray>>)
+    return bin_model<DataArray>(var).indices().use_count() == 1;
+  else
+    return bin_model<Dataset>(var).indices().use_count() == 1;
+}
+
+void set_bin_indices(Variable &var, const Variable &indices) {
+  if (var.dtype() == dtype<bucket<Variable>>)
+    bin_model<Variable>(var).indices() = indices.data_handle();
+  else if (var.dtype() == dtype<bucket<DataArray>>)
+    bin_model<DataArray>(var).indices() = indices.data_handle();
+  else
+    bin_model<Dataset>(var).indices() = indices.data_handle();
+}
+
+namespace buckets {
+/// Return the coord by which the contents of every bin of `var` are sorted in
+/// ascending order, or std::nullopt.
+///
+/// This is set by `buckets::sort`, which makes the key coord of the bin
+/// contents read-only. It is preserved by slicing and shallow copies. The
+/// marker applies only while the key coord is the read-only variable created
+/// by `sort`: Replacing or removing the coord clears it, and the read-only
+/// flag prevents in-place modification, including through views of the bins.
+/// Deep copies have a writable key coord and are not marked.
+std::optional<Dim> sorted_by(const Variable &var) {
+  if (var.dtype() != dtype<bucket<DataArray>>)
+    return std::nullopt;
+  const auto &model = bin_model<DataArray>(var);
+  const auto &key = model.sorted_by();
+  if (!key)
+    return std::nullopt;
+  const auto &dict = key_dict(model.buffer(), *key);
+  if (!dict.contains(*key))
+    return std::nullopt;
+  const auto &coord = dict[*key];
+  if (coord.is_readonly() && model.is_sorted_key(coord.data_handle()))
+    return key;
+  return std::nullopt;
+}
+} // namespace buckets
+
 REGISTER_FORMATTER(bin_DataArray, core::bin<DataArray>)
 REGISTER_FORMATTER(bin_Dataset, core::bin<Dataset>)
 
@@ -194,6 +194,72 @@ void init_buckets(py::module &m) {
         return dataset::buckets::append(a, b);
       },
       py::call_guard<py::gil_scoped_release>());
+  buckets.def(
+      "compact",
+      [](Variable &var) { return dataset::buckets::compact(var); },
+      py::call_guard<py::gil_scoped_release>());
+  buckets.def(
+      "compact",
+      [](DataArray &array) { return dataset::buckets::compact(array); },
+      py::call_guard<py::gil_scoped_release>());
+  buckets.def(
+      "sort",
+      [](const Variable &var, const std::string &key) {
+        return dataset::buckets::sort(var, Dim{key});
+      },
+      py::call_guard<py::gil_scoped_release>());
+  buckets.def(
+      "sort",
+      [](const DataArray &array, const std::string &key) {
+        return dataset::buckets::sort(array, Dim{key});
+      },
+      py::call_guard<py::gil_scoped_release>());
+  buckets.def(
+      "slice",
+      [](const Variable &var, const std::string &key,
+         const std::optional<Variable> &begin,
+         const std::optional<Variable> &end) {
+        return dataset::buckets::slice(var, Dim{key},
+                                       begin.value_or(Variable{}),
+                                       end.value_or(Variable{}));
+      },
+      py::call_guard<py::gil_scoped_release>());
+  buckets.def(
+      "slice",
+      [](const DataArray &array, const std::string &key,
+         const std::optional<Variable> &begin,
+         const std::optional<Variable> &end) {
+        return dataset::buckets::slice(array, Dim{key},
+                                       begin.value_or(Variable{}),
+                                       end.value_or(Variable{}));
+      },
+      py::call_guard<py::gil_scoped_release>());
+  buckets.def(
+      "slice_view",
+      [](const Variable &var, const std::string &key,
+         const std::optional<Variable> &begin,
+         const std::optional<Variable> &end) {
+        return dataset::buckets::slice_view(var, Dim{key},
+                                            begin.value_or(Variable{}),
+                                            end.value_or(Variable{}));
+      },
+      py::call_guard<py::gil_scoped_release>());
+  buckets.def(
+      "slice_view",
+      [](const DataArray &array, const std::string &key,
+         const std::optional<Variable> &begin,
+         const std::optional<Variable> &end) {
+        return dataset::buckets::slice_view(array, Dim{key},
+                                            begin.value_or(Variable{}),
+                                            end.value_or(Variable{}));
+      },
+      py::call_guard<py::gil_scoped_release>());
+  buckets.def("sorted_by",
+              [](const Variable &var) -> std::optional<std::string> {
+                if (const auto key = dataset::buckets::sorted_by(var))
+                  return key->name();
+                return std::nullopt;
+              });
   buckets.def(
       "map",
       [](const DataArray &function, const Variable &x, const std::string &dim,
@@ -220,5 +286,28 @@ void init_buckets(py::module &m) {
       py::arg("erase") = std::vector<std::string>{},
       py::call_guard<py::gil_scoped_release>());
 
+  py::class_<dataset::BinPlan>(
+      m, "BinPlan",
+      "Reusable setup for binning many tables with the same edges and groups.")
+      .def(py::init<const std::vector<Variable> &,
+                    const std::vector<Variable> &>(),
+           py::arg("edges"), py::arg("groups") = std::vector<Variable>{},
+           py::call_guard<py::gil_scoped_release>())
+      .def_property_readonly("edges", &dataset::BinPlan::edges)
+      .def_property_readonly("groups", &dataset::BinPlan::groups)
+      .def("target_bins", &dataset::BinPlan::target_bins, py::arg("table"),
+           py::call_guard<py::gil_scoped_release>(),
+           "Return the index of the target bin for every row of the table.")
+      .def(
+          "apply",
+          [](const dataset::BinPlan &self, const DataArray &table,
+             const std::optional<Variable> &target_bins) {
+            return target_bins ? self.apply(table, *target_bins)
+                               : self.apply(table);
+          },
+          py::arg("table"), py::arg("target_bins") = std::nullopt,
+          py::call_guard<py::gil_scoped_release>(),
+          "Bin the table, optionally using indices returned by target_bins.");
+
   bind_bins_view<DataArray>(m);
 }
@@ -0,0 +1,51 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+#include "scipp/core/memory_pool.h"
+
+#include "pybind11.h"
+
+using namespace scipp;
+
+namespace py = pybind11;
+
+void init_memory_pool(py::module &m) {
+  m.def(
+      "memory_pool_stats",
+      []() {
+        const auto stats = core::memory_pool().stats();
+        py::dict d;
+        d["bytes_live"] = stats.bytes_live;
+        d["bytes_cached"] = stats.bytes_cached;
+        d["hits"] = stats.hits;
+        d["misses"] = stats.misses;
+        d["hit_rate"] = stats.hit_rate();
+        return d;
+      },
+      R"(Return allocation statistics of the memory pool used for array buffers.
+
+The returned dict contains the number of bytes in use (``bytes_live``), the
+number of bytes of freed buffers retained for reuse (``bytes_cached``), the
+number of allocations served from and not served from retained buffers
+(``hits`` and ``misses``), and the resulting ``hit_rate``.)");
+
+  m.def(
+      "get_memory_pool_limit",
+      []() { return core::memory_pool().max_cached_bytes(); },
+      "Return the maximum number of bytes retained by the memory pool.");
+
+  m.def(
+      "set_memory_pool_limit",
+      [](const scipp::index bytes) {
+        core::memory_pool().set_max_cached_bytes(bytes);
+      },
+      py::arg("bytes"),
+      R"(Set the maximum number of bytes retained by the memory pool.
+
+Retained buffers exceeding the new limit are released. Use 0 to disable
+retaining freed buffers.)");
+
+  m.def(
+      "release_memory_pool", []() { core::memory_pool().release(); },
+      "Return all memory retained by the memory pool to the system.");
+}
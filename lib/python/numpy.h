@@ -4,6 +4,7 @@
 /// @author Simon Heybrock
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 #include <functional>
 
@@ -135,6 +136,25 @@ void copy_flattened_4d(const py::array_t<T> &data, View &&view) {
           copy_element<convert>(r(i, j, k, l), *it);
 }
 
+/// Copy `size` contiguous elements starting at `src` into `view`, in parallel.
+template <bool convert, class T, class View>
+void copy_flattened_contiguous(const T *src, const scipp::index size,
+                               View &&view) {
+  const auto begin = view.begin();
+  core::parallel::parallel_for(
+      core::parallel::blocked_range_by_work(0, size, sizeof(T)),
+      [&](const auto &range) {
+        auto it = begin + range.begin();
+        if constexpr (convert) {
+          for (scipp::index i = range.begin(); i < range.end(); ++i, ++it)
+            copy_element<convert>(src[i], *it);
+        } else {
+          std::copy(src + range.begin(), src + range.end(), it);
+        }
+      },
+      core::parallel::static_partitioner{});
+}
+
 template <class T> auto memory_begin_end(const py::buffer_info &info) {
   auto *begin = static_cast<const T *>(info.ptr);
   auto *end = static_cast<const T *>(info.ptr);
@@ -168,6 +188,9 @@ void copy_flattened(const py::array_t<T> &src, View &&dst) {
         "Numpy data size does not match size of target object.");
 
   const auto dispatch = [](const py::array_t<T> &src_, View &&dst_) {
+    if (src_.flags() & py::array::c_style)
+      return copy_flattened_contiguous<convert>(src_.data(), src_.size(),
+                                                std::forward<View>(dst_));
     switch (src_.ndim()) {
     case 0:
       return copy_flattened_0d<convert>(src_, std::forward<View>(dst_));
@@ -179,9 +202,12 @@ void copy_flattened(const py::array_t<T> &src, View &&dst) {
       return copy_flattened_3d<convert>(src_, std::forward<View>(dst_));
     case 4:
       return copy_flattened_4d<convert>(src_, std::forward<View>(dst_));
-    default:
-      throw std::runtime_error("Numpy array has more dimensions than supported "
-                               "in the current implementation.");
+    default: {
+      // Let numpy produce a contiguous copy for high-dimensional input.
+      const py::array_t<T, py::array::c_style> contiguous(src_);
+      return copy_flattened_contiguous<convert>(
+          contiguous.data(), contiguous.size(), std::forward<View>(dst_));
+    }
     }
   };
   dispatch(memory_overlaps(src, dst) ? py::array_t<T>(src.request()) : src,
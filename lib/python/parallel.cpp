@@ -0,0 +1,57 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+#include <optional>
+
+#include "scipp/core/parallel.h"
+
+#include "pybind11.h"
+
+using namespace scipp;
+
+namespace py = pybind11;
+
+namespace {
+struct PyThreadLimit {
+  scipp::index max_threads;
+  std::optional<core::parallel::ThreadLimit> limit;
+};
+} // namespace
+
+void init_parallel(py::module &m) {
+  m.def(
+      "get_max_threads", []() { return core::parallel::max_concurrency(); },
+      R"(Return the maximum number of threads used by scipp operations called
+from the current thread.)");
+
+  m.def(
+      "set_max_threads",
+      [](const scipp::index max_threads) {
+        core::parallel::set_max_threads(max_threads);
+      },
+      py::arg("max_threads"),
+      R"(Set the maximum number of threads used by scipp.
+
+The limit applies process-wide, including other libraries using TBB. Use 0 to
+restore the default, which is the number of available cores.)");
+
+  py::class_<PyThreadLimit>(m, "thread_limit",
+                            R"(Context manager limiting the number of threads.
+
+Limits the number of threads used by scipp operations called from the current
+thread within the context, e.g., to avoid oversubscription when running
+multiple workers in a process. Other threads are not affected.)")
+      .def(py::init([](const scipp::index max_threads) {
+             return PyThreadLimit{max_threads, std::nullopt};
+           }),
+           py::arg("max_threads"))
+      .def(
+          "__enter__",
+          [](PyThreadLimit &self) -> PyThreadLimit & {
+            self.limit.emplace(self.max_threads);
+            return self;
+          },
+          py::return_value_policy::reference_internal)
+      .def("__exit__",
+           [](PyThreadLimit &self, const py::args &) { self.limit.reset(); });
+}
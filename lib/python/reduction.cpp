@@ -0,0 +1,80 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+#include "pybind11.h"
+
+#include "scipp/dataset/reduce_many.h"
+#include "scipp/dataset/reduction.h"
+#include "scipp/variable/reduction.h"
+
+using namespace scipp;
+using namespace scipp::variable;
+using namespace scipp::dataset;
+
+namespace py = pybind11;
+
+namespace {
+std::vector<Reduction> get_reductions(const std::vector<std::string> &names) {
+  std::vector<Reduction> reductions;
+  for (const auto &name : names) {
+    if (name == "sum")
+      reductions.push_back(Reduction::Sum);
+    else if (name == "mean")
+      reductions.push_back(Reduction::Mean);
+    else if (name == "min")
+      reductions.push_back(Reduction::Min);
+    else if (name == "max")
+      reductions.push_back(Reduction::Max);
+    else if (name == "count")
+      reductions.push_back(Reduction::Count);
+    else
+      throw std::invalid_argument("Reduction must be one of 'sum', 'mean', "
+                                  "'min', 'max', or 'count', got '" +
+                                  name + "'.");
+  }
+  return reductions;
+}
+
+SumMode get_sum_mode(const std::string &mode) {
+  if (mode == "default")
+    return SumMode::Default;
+  if (mode == "deterministic")
+    return SumMode::Deterministic;
+  throw std::invalid_argument(
+      "Sum mode must be either 'default' or 'deterministic'.");
+}
+
+template <class T> void bind_sum(py::module &m) {
+  m.def(
+      "sum",
+      [](const T &x, const std::string &mode) {
+        return sum(x, get_sum_mode(mode));
+      },
+      py::arg("x"), py::arg("mode"), py::call_guard<py::gil_scoped_release>());
+  m.def(
+      "sum",
+      [](const T &x, const std::string &dim, const std::string &mode) {
+        return sum(x, Dim{dim}, get_sum_mode(mode));
+      },
+      py::arg("x"), py::arg("dim"), py::arg("mode"),
+      py::call_guard<py::gil_scoped_release>());
+}
+
+template <class T> void bind_reduce_many(py::module &m) {
+  m.def(
+      "reduce_many",
+      [](const T &x, const std::string &dim,
+         const std::vector<std::string> &reductions) {
+        return reduce_many(x, Dim{dim}, get_reductions(reductions));
+      },
+      py::arg("x"), py::arg("dim"), py::arg("reductions"),
+      py::call_guard<py::gil_scoped_release>());
+}
+} // namespace
+
+void init_reduction(py::module &m) {
+  bind_sum<Variable>(m);
+  bind_sum<DataArray>(m);
+  bind_reduce_many<Variable>(m);
+  bind_reduce_many<DataArray>(m);
+}
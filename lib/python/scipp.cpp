@@ -18,6 +18,9 @@ void init_exceptions(py::module &);
 void init_groupby(py::module &);
 void init_geometry(py::module &);
 void init_histogram(py::module &);
+void init_memory_pool(py::module &);
+void init_parallel(py::module &);
+void init_reduction(py::module &);
 void init_operations(py::module &);
 void init_shape(py::module &);
 void init_trigonometry(py::module &);
@@ -58,6 +61,9 @@ void init_core(py::module &m) {
   init_trigonometry(core);
   init_unary(core);
   init_element_array_view(core);
+  init_memory_pool(core);
+  init_parallel(core);
+  init_reduction(core);
 
   init_generated_arithmetic(core);
   init_generated_bins(core);
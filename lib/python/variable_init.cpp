@@ -3,6 +3,9 @@
 /// @file
 /// @author Jan-Lukas Wynen
 
+#include <memory>
+#include <optional>
+
 #include "pybind11.h"
 
 #include "scipp/core/dtype.h"
@@ -169,14 +172,59 @@ python::PyObject extract_scalar<python::PyObject>(const py::object &obj,
   return obj;
 }
 
+/// Return true if the interpreter is shutting down.
+bool is_finalizing() noexcept {
+#if PY_VERSION_HEX >= 0x030D0000
+  return Py_IsFinalizing();
+#else
+  return _Py_IsFinalizing();
+#endif
+}
+
+/// Wrap the memory of `source` if it is a numpy array with exactly matching
+/// dtype and memory layout. The array is kept alive by the element_array.
+///
+/// The reference to the array is released by whichever thread drops the last
+/// reference to the buffer. This may be a thread not created by Python, e.g.,
+/// a TBB worker, for which gil_scoped_acquire creates a thread state. If the
+/// interpreter is finalizing or has been finalized, acquiring the GIL is not
+/// possible anymore and the reference is leaked instead.
+template <class T>
+std::optional<element_array<T>> borrow_element_array(const py::object &source) {
+  if constexpr (core::is_pool_allocatable_v<T> && !ElementTypeMap<T>::convert) {
+    if (!py::isinstance<py::array_t<T>>(source))
+      return std::nullopt;
+    auto array = source.cast<py::array_t<T>>();
+    if (!(array.flags() & py::array::c_style) || !array.writeable() ||
+        !array.attr("flags").attr("aligned").template cast<bool>())
+      return std::nullopt;
+    auto *data = array.mutable_data();
+    const py::handle handle = array.inc_ref();
+    std::shared_ptr<void> owner(data, [handle](void *) {
+      if (!Py_IsInitialized() || is_finalizing())
+        return;
+      py::gil_scoped_acquire acquire;
+      handle.dec_ref();
+    });
+    return element_array<T>(data, array.size(), std::move(owner),
+                            core::borrow);
+  } else {
+    static_cast<void>(source);
+    return std::nullopt;
+  }
+}
+
 template <class T>
 auto make_element_array(const Dimensions &dims, const py::object &source,
-                        const units::Unit unit) {
+                        const units::Unit unit, const bool copy) {
   if (source.is_none()) {
     return element_array<T>();
   } else if (dims.ndim() == 0) {
     return element_array<T>(1, extract_scalar<T>(source, unit));
   } else {
+    if (!copy)
+      if (auto borrowed = borrow_element_array<T>(source))
+        return std::move(*borrowed);
     element_array<T> array(dims.volume(), core::init_for_overwrite);
     copy_array_into_view(cast_to_array_like<T>(source, unit), array, dims);
     return array;
@@ -185,16 +233,18 @@ auto make_element_array(const Dimensions &dims, const py::object &source,
 
 template <class T> struct MakeVariable {
   static Variable apply(const Dimensions &dims, const py::object &values,
-                        const py::object &variances, const units::Unit unit) {
+                        const py::object &variances, const units::Unit unit,
+                        const bool copy) {
     const auto [values_unit, final_unit] = common_unit<T>(values, unit);
     auto values_array =
-        Values(make_element_array<T>(dims, values, values_unit));
+        Values(make_element_array<T>(dims, values, values_unit, copy));
     auto variable = variances.is_none()
                         ? makeVariable<T>(dims, std::move(values_array))
                         // cppcheck-suppress accessMoved  # False-positive.
                         : makeVariable<T>(dims, std::move(values_array),
                                           Variances(make_element_array<T>(
-                                              dims, variances, values_unit)));
+                                              dims, variances, values_unit,
+                                              copy)));
     variable.setUnit(values_unit);
     return to_unit(variable, final_unit, CopyPolicy::TryAvoid);
   }
@@ -202,7 +252,8 @@ template <class T> struct MakeVariable {
 
 Variable make_variable(const py::object &dim_labels, const py::object &values,
                        const py::object &variances,
-                       const std::optional<units::Unit> &unit_, DType dtype) {
+                       const std::optional<units::Unit> &unit_, DType dtype,
+                       const bool copy) {
   const auto converted_values = parse_data_sequence(dim_labels, values);
   const auto converted_variances = parse_data_sequence(dim_labels, variances);
   dtype = common_dtype(converted_values, converted_variances, dtype);
@@ -215,7 +266,7 @@ Variable make_variable(const py::object &dim_labels, const py::object &values,
                          python::PyObject>::apply<MakeVariable>(dtype, dims,
                                                                 values,
                                                                 variances,
-                                                                unit);
+                                                                unit, copy);
 }
 } // namespace
 
@@ -227,7 +278,7 @@ void bind_init(py::class_<Variable> &cls) {
   cls.def(
       py::init([](const py::object &dim_labels, const py::object &values,
                   const py::object &variances, const ProtoUnit unit,
-                  const py::object &dtype) {
+                  const py::object &dtype, const bool copy) {
         if (values.is_none() && variances.is_none()) {
           throw std::invalid_argument(
               "At least one argument of 'values' and 'variances' is required.");
@@ -235,11 +286,11 @@ void bind_init(py::class_<Variable> &cls) {
         const auto [scipp_dtype, actual_unit] =
             cast_dtype_and_unit(dtype, unit);
         return make_variable(dim_labels, values, variances, actual_unit,
-                             scipp_dtype);
+                             scipp_dtype, copy);
       }),
       py::kw_only(), py::arg("dims"), py::arg("values") = py::none(),
       py::arg("variances") = py::none(), py::arg("unit") = DefaultUnit{},
-      py::arg("dtype") = py::none(),
+      py::arg("dtype") = py::none(), py::arg("copy") = true,
       R"raw(
 Initialize a variable with values and/or variances.
 
@@ -267,5 +318,10 @@ dtype:
    Type of the variable's elements. Is deduced from other arguments
    in most cases. Defaults to ``sc.DType.float64`` if no deduction is
    possible.
+copy:
+   If ``False``, ``values`` and ``variances`` that are C-contiguous, aligned,
+   and writeable numpy arrays of exactly the requested dtype are used without
+   copying. The variable then shares memory with the arrays.
+   Other inputs are always copied.
 )raw");
 }
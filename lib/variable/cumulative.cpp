@@ -2,10 +2,15 @@
 // Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
 /// @file
 /// @author Simon Heybrock
+#include <algorithm>
+
 #include "scipp/variable/cumulative.h"
 #include "scipp/core/element/cumulative.h"
+#include "scipp/core/parallel.h"
+#include "scipp/core/tag_util.h"
 #include "scipp/variable/accumulate.h"
 #include "scipp/variable/astype.h"
+#include "scipp/variable/bins.h"
 #include "scipp/variable/util.h"
 
 using namespace scipp;
@@ -16,14 +21,172 @@ namespace {
 auto as_precise(const Variable &var) {
   return (var.dtype() == dtype<float>) ? astype(var, dtype<double>) : var;
 }
+
+/// Parallel scan of a contiguous array with shape (outer, size, inner) along
+/// the middle axis.
+///
+/// Independent lanes, i.e., outer indices and blocks of the inner axis, are
+/// processed in parallel. If there are too few lanes a two-pass blocked scan
+/// along the middle axis is used instead: The first pass computes the sums of
+/// every block, the second pass scans every block starting from the
+/// (exclusive) scan of the block sums.
+template <class T> struct Scan {
+  // float is accumulated in double, as in as_precise.
+  using Acc = std::conditional_t<std::is_same_v<T, float>, double, T>;
+  static constexpr scipp::index lane_block = 1024;
+  static constexpr scipp::index min_elements_per_task = 65536;
+  static constexpr scipp::index max_blocks = 64;
+
+  T *data;
+  scipp::index outer;
+  scipp::index size;
+  scipp::index inner;
+  bool inclusive;
+
+  /// Scan rows [begin, end) of lanes [j0, j0 + n) of outer index `o`, starting
+  /// from and updating `sum`.
+  void scan_rows(Acc *sum, const scipp::index o, const scipp::index begin,
+                 const scipp::index end, const scipp::index j0,
+                 const scipp::index n) const {
+    for (scipp::index i = begin; i < end; ++i) {
+      T *row = data + (o * size + i) * inner + j0;
+      for (scipp::index j = 0; j < n; ++j) {
+        const Acc x = row[j];
+        sum[j] += x;
+        row[j] = static_cast<T>(inclusive ? sum[j] : sum[j] - x);
+      }
+    }
+  }
+
+  void operator()() const {
+    const auto volume = outer * size * inner;
+    const auto nlane_block = (inner + lane_block - 1) / lane_block;
+    const auto nlane_task = outer * nlane_block;
+    // The choice of algorithm and the block boundaries define the rounding of
+    // floating-point results, so they depend only on the shape, not on the
+    // number of threads.
+    const auto max_task = std::clamp<scipp::index>(
+        volume / min_elements_per_task, 1, max_blocks);
+    if (nlane_task >= max_task || size < 2 * max_task)
+      scan_lanes(nlane_block);
+    else
+      scan_blocks(max_task);
+  }
+
+  void scan_lanes(const scipp::index nlane_block) const {
+    core::parallel::parallel_for(
+        core::parallel::blocked_range_by_work(
+            0, outer * nlane_block,
+            2 * sizeof(T) * size * std::min(inner, lane_block)),
+        [&](const auto &range) {
+          std::vector<Acc> sum;
+          for (auto task = range.begin(); task != range.end(); ++task) {
+            const auto o = task / nlane_block;
+            const auto j0 = task % nlane_block * lane_block;
+            const auto n = std::min(lane_block, inner - j0);
+            sum.assign(n, Acc{0});
+            scan_rows(sum.data(), o, 0, size, j0, n);
+          }
+        },
+        core::parallel::static_partitioner{});
+  }
+
+  void scan_blocks(const scipp::index nblock) const {
+    const auto nlane = outer * inner;
+    const auto block_begin = [&](const scipp::index block) {
+      return size * block / nblock;
+    };
+    // sums[block * nlane + lane]
+    std::vector<Acc> sums(nblock * nlane, Acc{0});
+    core::parallel::parallel_for(
+        core::parallel::blocked_range(0, nblock, 1), [&](const auto &range) {
+          for (auto block = range.begin(); block != range.end(); ++block)
+            for (scipp::index o = 0; o < outer; ++o)
+              for (auto i = block_begin(block); i < block_begin(block + 1);
+                   ++i) {
+                const T *row = data + (o * size + i) * inner;
+                Acc *sum = sums.data() + block * nlane + o * inner;
+                for (scipp::index j = 0; j < inner; ++j)
+                  sum[j] += row[j];
+              }
+        });
+    // Exclusive scan of block sums, giving the initial sum of every block.
+    std::vector<Acc> total(nlane, Acc{0});
+    for (scipp::index block = 0; block < nblock; ++block)
+      for (scipp::index lane = 0; lane < nlane; ++lane) {
+        const auto x = sums[block * nlane + lane];
+        sums[block * nlane + lane] = total[lane];
+        total[lane] += x;
+      }
+    core::parallel::parallel_for(
+        core::parallel::blocked_range(0, nblock, 1), [&](const auto &range) {
+          for (auto block = range.begin(); block != range.end(); ++block)
+            for (scipp::index o = 0; o < outer; ++o)
+              scan_rows(sums.data() + block * nlane + o * inner, o,
+                        block_begin(block), block_begin(block + 1), 0, inner);
+        });
+  }
+};
+
+template <class T> struct ScanContiguous {
+  static void apply(Variable &var, const scipp::index outer,
+                    const scipp::index size, const scipp::index inner,
+                    const CumSumMode mode) {
+    Scan<T>{var.values<T>().data(), outer, size, inner,
+            mode == CumSumMode::Inclusive}();
+  }
+};
+
+template <class T> struct ScanBins {
+  static void apply(const Variable &indices, Variable &buffer,
+                    const CumSumMode mode) {
+    const auto ranges = indices.values<scipp::index_pair>();
+    const auto size = buffer.dims().volume() == 0 ? 0 : buffer.dims().size(0);
+    const auto inner = size == 0 ? 0 : buffer.dims().volume() / size;
+    const Scan<T> scan{buffer.values<T>().data(), 1, size, inner,
+                       mode == CumSumMode::Inclusive};
+    core::parallel::parallel_for(
+        core::parallel::blocked_range(0, ranges.size()),
+        [&](const auto &range) {
+          std::vector<typename Scan<T>::Acc> sum;
+          for (auto bin = range.begin(); bin != range.end(); ++bin) {
+            const auto [begin, end] = ranges[bin];
+            sum.assign(inner, 0);
+            scan.scan_rows(sum.data(), 0, begin, end, 0, inner);
+          }
+        });
+  }
+};
+
+/// Return true if `var` can be scanned with class Scan, i.e., it has one of
+/// the supported dtypes, no variances, and a contiguous layout.
+bool is_scannable(const Variable &var) {
+  return (var.dtype() == dtype<double> || var.dtype() == dtype<float> ||
+          var.dtype() == dtype<int64_t> || var.dtype() == dtype<int32_t>) &&
+         !var.has_variances() && Strides(var.strides()) == Strides(var.dims());
+}
+
+template <class... Args> void scan(const DType dtype, Args &&...args) {
+  core::CallDType<double, float, int64_t, int32_t>::apply<ScanContiguous>(
+      dtype, std::forward<Args>(args)...);
+}
 } // namespace
 
 Variable cumsum(const Variable &var, const Dim dim, const CumSumMode mode) {
   if (var.dims()[dim] == 0)
     return copy(var);
+  Variable out = copy(var);
+  if (is_scannable(out)) {
+    const auto &dims = out.dims();
+    scipp::index outer = 1;
+    for (scipp::index i = 0; i < dims.index(dim); ++i)
+      outer *= dims.size(i);
+    scan(out.dtype(), out, outer, dims[dim],
+         dims.volume() / (outer * dims[dim]), mode);
+    return out;
+  }
   Variable cumulative = as_precise(copy(var.slice({dim, 0})));
   fill_zeros(cumulative);
-  Variable out = copy(var);
   if (mode == CumSumMode::Inclusive)
     accumulate_in_place(cumulative, out, core::element::inclusive_scan,
                         "cumsum");
@@ -34,8 +197,12 @@ Variable cumsum(const Variable &var, const Dim dim, const CumSumMode mode) {
 }
 
 Variable cumsum(const Variable &var, const CumSumMode mode) {
-  Variable cumulative(as_precise(Variable(var, Dimensions{})));
   Variable out = copy(var);
+  if (is_scannable(out)) {
+    scan(out.dtype(), out, 1, out.dims().volume(), 1, mode);
+    return out;
+  }
+  Variable cumulative(as_precise(Variable(var, Dimensions{})));
   if (mode == CumSumMode::Inclusive)
     accumulate_in_place(cumulative, out, core::element::inclusive_scan,
                         "cumsum");
@@ -47,6 +214,14 @@ Variable cumsum(const Variable &var, const CumSumMode mode) {
 
 Variable cumsum_bins(const Variable &var, const CumSumMode mode) {
   Variable out = copy(var);
+  if (out.dtype() == dtype<bucket<Variable>>) {
+    auto &&[indices, dim, buffer] = out.constituents<Variable>();
+    if (is_scannable(buffer) && buffer.dims().index(dim) == 0) {
+      core::CallDType<double, float, int64_t, int32_t>::apply<ScanBins>(
+          buffer.dtype(), indices, buffer, mode);
+      return out;
+    }
+  }
   const auto type = variable::variableFactory().elem_dtype(var);
   auto cumulative = Variable(type == dtype<float> ? dtype<double> : type,
                              var.dims(), var.unit());
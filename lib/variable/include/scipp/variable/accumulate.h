@@ -73,7 +73,17 @@ static void do_accumulate(const std::tuple<Ts...> &types, Op op,
       // speedup in many cases.
       const auto outer_dim = (*other.dims().begin(), ...);
       const auto outer_size = (other.dims()[outer_dim], ...);
-      const auto nchunk = std::min(scipp::index(24), outer_size);
+      // The number of chunks defines the order of accumulation, so it must not
+      // depend on the number of threads, otherwise floating-point results
+      // would differ between machines. More chunks are used for large inputs
+      // to allow for more parallelism.
+      constexpr scipp::index min_chunks = 24;
+      constexpr scipp::index max_chunks = 64;
+      constexpr scipp::index elements_per_chunk = 65536;
+      const auto volume = (other.dims().volume(), ...);
+      const auto nchunk = std::min(
+          {outer_size, max_chunks,
+           std::max(min_chunks, volume / elements_per_chunk)});
       const auto chunk_size = (outer_size + nchunk - 1) / nchunk;
       // The threading approach in used here is possible only under the
       // assumption that op(var, broadcast(var, ...)) leaves var unchanged. This
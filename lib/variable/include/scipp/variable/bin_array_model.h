@@ -4,6 +4,8 @@
 /// @author Simon Heybrock
 #pragma once
 #include <algorithm>
+#include <memory>
+#include <optional>
 
 #include "scipp/core/bucket_array_view.h"
 #include "scipp/core/dimensions.h"
@@ -91,6 +93,35 @@ public:
   const T &buffer() const noexcept { return m_buffer; }
   T &buffer() noexcept { return m_buffer; }
 
+  /// Name of the coord by which the contents of every bin were sorted in
+  /// ascending order, if any.
+  ///
+  /// The marker records the data of the key coord at the time of sorting. It
+  /// applies only as long as the key coord in the buffer still refers to this
+  /// data, see `is_sorted_key`.
+  const std::optional<Dim> &sorted_by() const noexcept { return m_sorted_by; }
+  /// True if `data` is the data recorded by `set_sorted_by`.
+  bool is_sorted_key(const VariableConceptHandle &data) const noexcept {
+    return m_sorted_by && !m_sorted_key.expired() &&
+           !m_sorted_key.owner_before(data) && !data.owner_before(m_sorted_key);
+  }
+  void set_sorted_by(const std::optional<Dim> &key,
+                     const VariableConceptHandle &data) noexcept {
+    m_sorted_by = key;
+    m_sorted_key = data;
+  }
+
+  /// True if buffer rows between and after bins are unused capacity, which
+  /// may be filled in place when appending to bins.
+  ///
+  /// This is false unless set by an operation that allocated the buffer,
+  /// since bins sharing their buffer with other bins may have gaps that are
+  /// in use elsewhere.
+  bool has_capacity() const noexcept { return m_has_capacity; }
+  void set_has_capacity(const bool has_capacity) noexcept {
+    m_has_capacity = has_capacity;
+  }
+
   ElementArrayView<bucket<T>> values(const core::ElementArrayViewParams &base) {
     return {index_values(base), this->bin_dim(), m_buffer};
   }
@@ -112,6 +143,9 @@ private:
   ElementArrayView<const scipp::index_pair>
   index_values(const core::ElementArrayViewParams &base) const;
   T m_buffer;
+  std::optional<Dim> m_sorted_by;
+  std::weak_ptr<VariableConcept> m_sorted_key;
+  bool m_has_capacity{false};
 };
 
 template <class T> BinArrayModel<T> copy(const BinArrayModel<T> &model);
@@ -178,8 +178,10 @@ public:
 };
 
 template <class T> BinArrayModel<T> copy(const BinArrayModel<T> &model) {
-  return BinArrayModel<T>(model.indices()->clone(), model.bin_dim(),
-                          copy(model.buffer()));
+  BinArrayModel<T> out(model.indices()->clone(), model.bin_dim(),
+                       copy(model.buffer()));
+  out.set_has_capacity(model.has_capacity());
+  return out;
 }
 
 template <class T>
@@ -4,6 +4,7 @@
 /// @author Simon Heybrock
 #pragma once
 #include <optional>
+#include <type_traits>
 
 #include "scipp/common/initialization.h"
 #include "scipp/common/numeric.h"
@@ -11,6 +12,7 @@
 #include "scipp/core/eigen.h"
 #include "scipp/core/element_array_view.h"
 #include "scipp/core/except.h"
+#include "scipp/core/strided_copy.h"
 #include "scipp/units/unit.h"
 #include "scipp/variable/except.h"
 #include "scipp/variable/transform.h"
@@ -139,9 +141,29 @@ constexpr auto do_copy = [](auto &a, const auto &b) { a = copy(b); };
 /// Helper for implementing Variable(View) copy operations.
 ///
 /// This method is using virtual dispatch as a trick to obtain T, such that
-/// transform can be called with any T.
+/// transform can be called with any T. Trivially copyable elements are copied
+/// with core::strided_copy unless a case requiring the checks and overlap
+/// handling of transform is encountered.
 template <class T>
 void ElementArrayModel<T>::copy(const Variable &src, Variable &dest) const {
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    if (dest.dtype() == core::dtype<T> &&
+        dest.has_variances() == src.has_variances() &&
+        dest.dims().includes(src.dims())) {
+      auto dest_values = dest.values<T>();
+      const ElementArrayView<const T> src_values(src.values<T>(),
+                                                 dest.dims());
+      if (core::can_strided_copy(src_values, dest_values)) {
+        dest.setUnit(src.unit());
+        core::strided_copy(src_values, dest_values);
+        if (src.has_variances())
+          core::strided_copy(
+              ElementArrayView<const T>(src.variances<T>(), dest.dims()),
+              dest.variances<T>());
+        return;
+      }
+    }
+  }
   transform_in_place<T>(
       dest, src,
       overloaded{core::transform_flags::expect_in_variance_if_out_variance,
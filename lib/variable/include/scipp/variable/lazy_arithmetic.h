@@ -0,0 +1,172 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file Opt-in lazy evaluation of chained arithmetic on variables.
+///
+/// Expressions such as `lazy::expr(a) * b + c / d` build a small expression
+/// tree instead of computing a temporary variable per operator. The tree is
+/// materialized in a single fused `transform` on conversion to `Variable` or
+/// by `evaluate`, so each input is read once and only the result is
+/// allocated. Units are computed once from the tree before the transform.
+#pragma once
+
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "scipp/core/element/arithmetic.h"
+#include "scipp/variable/arithmetic.h"
+#include "scipp/variable/bins.h"
+#include "scipp/variable/transform.h"
+#include "scipp/variable/variable_factory.h"
+
+namespace scipp::variable::lazy {
+
+/// Leaf of an expression, referencing an input variable.
+struct Leaf {
+  static constexpr size_t size = 1;
+  Variable var;
+};
+
+template <class Op, class Lhs, class Rhs> struct Binary {
+  static constexpr size_t size = Lhs::size + Rhs::size;
+  Lhs lhs;
+  Rhs rhs;
+};
+
+struct Add {
+  static constexpr auto element = core::element::add;
+  static Variable eager(const Variable &a, const Variable &b) { return a + b; }
+};
+struct Subtract {
+  static constexpr auto element = core::element::subtract;
+  static Variable eager(const Variable &a, const Variable &b) { return a - b; }
+};
+struct Multiply {
+  static constexpr auto element = core::element::multiply;
+  static Variable eager(const Variable &a, const Variable &b) { return a * b; }
+};
+struct Divide {
+  static constexpr auto element = core::element::divide;
+  static Variable eager(const Variable &a, const Variable &b) { return a / b; }
+};
+
+namespace detail {
+inline auto leaves(const Leaf &leaf) { return std::tuple{leaf.var}; }
+template <class Op, class Lhs, class Rhs>
+auto leaves(const Binary<Op, Lhs, Rhs> &node) {
+  return std::tuple_cat(leaves(node.lhs), leaves(node.rhs));
+}
+
+/// Compute the expression for a single element, or for units. Leaf values are
+/// taken from `args`, starting at `Offset` for the leaves of `Node`.
+template <class Node, size_t Offset> struct compute;
+template <size_t Offset> struct compute<Leaf, Offset> {
+  template <class Args> static decltype(auto) apply(const Args &args) {
+    return std::get<Offset>(args);
+  }
+};
+template <class Op, class Lhs, class Rhs, size_t Offset>
+struct compute<Binary<Op, Lhs, Rhs>, Offset> {
+  template <class Args> static auto apply(const Args &args) {
+    return Op::element(compute<Lhs, Offset>::apply(args),
+                       compute<Rhs, Offset + Lhs::size>::apply(args));
+  }
+};
+
+inline Variable eager(const Leaf &leaf) { return leaf.var; }
+template <class Op, class Lhs, class Rhs>
+Variable eager(const Binary<Op, Lhs, Rhs> &node) {
+  return Op::eager(eager(node.lhs), eager(node.rhs));
+}
+
+/// Return true if the leaves can be processed in a fused transform.
+///
+/// This requires dense inputs of the same floating-point dtype. Inputs with
+/// variances that are used more than once are correlated, which is handled
+/// only by the eager operators.
+template <class... Vars> bool can_fuse(const Vars &...vars) {
+  const auto &first = std::get<0>(std::tie(vars...));
+  if (first.dtype() != dtype<double> && first.dtype() != dtype<float>)
+    return false;
+  if (((vars.dtype() != first.dtype() || is_bins(vars)) || ...))
+    return false;
+  const auto correlated = [&](const Variable &var) {
+    return var.has_variances() &&
+           ((&var != &vars && var.is_same(vars)) || ...);
+  };
+  return !(correlated(vars) || ...);
+}
+} // namespace detail
+
+/// Lazy arithmetic expression of variables.
+///
+/// Converts implicitly to `Variable`, which evaluates the expression.
+template <class Node> struct Expr {
+  Node node;
+  [[nodiscard]] Variable evaluate() const;
+  operator Variable() const { return evaluate(); }
+};
+
+template <class T> struct is_expr : std::false_type {};
+template <class Node> struct is_expr<Expr<Node>> : std::true_type {};
+
+template <class T> auto as_node(const T &x) {
+  if constexpr (is_expr<T>::value)
+    return x.node;
+  else
+    return Leaf{x};
+}
+
+template <class Op, class A, class B>
+using enable_if_expr =
+    std::enable_if_t<(is_expr<A>::value || is_expr<B>::value) &&
+                         (is_expr<A>::value || std::is_same_v<A, Variable>) &&
+                         (is_expr<B>::value || std::is_same_v<B, Variable>),
+                     Expr<Binary<Op, decltype(as_node(std::declval<A>())),
+                                 decltype(as_node(std::declval<B>()))>>>;
+
+template <class A, class B>
+enable_if_expr<Add, A, B> operator+(const A &a, const B &b) {
+  return {{as_node(a), as_node(b)}};
+}
+template <class A, class B>
+enable_if_expr<Subtract, A, B> operator-(const A &a, const B &b) {
+  return {{as_node(a), as_node(b)}};
+}
+template <class A, class B>
+enable_if_expr<Multiply, A, B> operator*(const A &a, const B &b) {
+  return {{as_node(a), as_node(b)}};
+}
+template <class A, class B>
+enable_if_expr<Divide, A, B> operator/(const A &a, const B &b) {
+  return {{as_node(a), as_node(b)}};
+}
+
+template <class Node> Variable Expr<Node>::evaluate() const {
+  return std::apply(
+      [this](const auto &...vars) {
+        if (!detail::can_fuse(vars...))
+          return detail::eager(node);
+        const auto op = [](const auto &...args) {
+          return detail::compute<Node, 0>::apply(
+              std::forward_as_tuple(args...));
+        };
+        return variable::detail::transform(std::tuple<double, float>{},
+                                           overloaded{op}, "lazy", vars...);
+      },
+      detail::leaves(node));
+}
+
+/// Start a lazy arithmetic expression from `var`.
+inline Expr<Leaf> expr(const Variable &var) { return {{var}}; }
+
+/// Evaluate a lazy arithmetic expression in a single fused transform.
+template <class Node> Variable evaluate(const Expr<Node> &expr) {
+  return expr.evaluate();
+}
+
+} // namespace scipp::variable::lazy
+
+namespace scipp {
+namespace lazy = variable::lazy;
+} // namespace scipp
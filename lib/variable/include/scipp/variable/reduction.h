@@ -4,11 +4,19 @@
 /// @author Simon Heybrock
 #pragma once
 
+#include <vector>
+
 #include "scipp-variable_export.h"
 #include "scipp/core/flags.h"
 #include "scipp/variable/variable.h"
 
 namespace scipp::variable {
+enum class SCIPP_VARIABLE_EXPORT Reduction { Sum, Mean, Min, Max, Count };
+
+/// Summation algorithm. `Deterministic` gives bitwise reproducible results
+/// independent of the number of threads.
+enum class SCIPP_VARIABLE_EXPORT SumMode { Default, Deterministic };
+
 [[nodiscard]] SCIPP_VARIABLE_EXPORT Variable mean(const Variable &var);
 [[nodiscard]] SCIPP_VARIABLE_EXPORT Variable mean(const Variable &var,
                                                   const Dim dim);
@@ -16,6 +24,11 @@ namespace scipp::variable {
 [[nodiscard]] SCIPP_VARIABLE_EXPORT Variable sum(const Variable &var);
 [[nodiscard]] SCIPP_VARIABLE_EXPORT Variable sum(const Variable &var,
                                                  const Dim dim);
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable sum(const Variable &var,
+                                                 const SumMode mode);
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable sum(const Variable &var,
+                                                 const Dim dim,
+                                                 const SumMode mode);
 
 // Logical reductions
 [[nodiscard]] SCIPP_VARIABLE_EXPORT Variable any(const Variable &var);
@@ -46,6 +59,12 @@ namespace scipp::variable {
 [[nodiscard]] SCIPP_VARIABLE_EXPORT Variable nanmean(const Variable &var,
                                                      const Dim dim);
 
+// Several reductions computed in a single pass over the input.
+[[nodiscard]] SCIPP_VARIABLE_EXPORT std::vector<Variable>
+reduce_many(const Variable &var, const Dim dim,
+            const std::vector<Reduction> &reductions,
+            const Variable &mask = Variable{});
+
 // Reductions of all events within a bin.
 [[nodiscard]] SCIPP_VARIABLE_EXPORT Variable bins_sum(const Variable &data);
 [[nodiscard]] SCIPP_VARIABLE_EXPORT Variable bins_nansum(const Variable &data);
@@ -69,3 +88,8 @@ SCIPP_VARIABLE_EXPORT void nanmax_into(Variable &accum, const Variable &var);
 SCIPP_VARIABLE_EXPORT void min_into(Variable &accum, const Variable &var);
 SCIPP_VARIABLE_EXPORT void nanmin_into(Variable &accum, const Variable &var);
 } // namespace scipp::variable
+
+namespace scipp {
+using variable::Reduction;
+using variable::SumMode;
+}
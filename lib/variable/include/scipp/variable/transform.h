@@ -79,6 +79,20 @@ template <class T> static constexpr auto array_params(T &&iterable) noexcept {
     return iterable;
 }
 
+/// Estimate of the number of bytes touched when processing a single item of
+/// the iteration range. For binned data items are bins, so the average bin size
+/// is used for the estimate.
+template <class T> scipp::index bytes_per_item(const T &iterable) {
+  const auto &params = array_params(iterable);
+  scipp::index bytes =
+      sizeof(typename std::decay_t<decltype(params)>::value_type);
+  if constexpr (is_ValuesAndVariances_v<std::decay_t<T>>)
+    bytes *= 2;
+  if (const auto &bins = params.bucketParams(); bins && params.size() > 0)
+    bytes *= std::max(scipp::index(1), bins.dims.volume() / params.size());
+  return bytes;
+}
+
 template <size_t N_Operands, bool in_place>
 inline constexpr auto stride_special_cases =
     std::array<std::array<scipp::index, N_Operands>, 0>{};
@@ -100,6 +114,15 @@ inline constexpr auto stride_special_cases<3, false> =
     std::array<std::array<scipp::index, 3>, 3>{
         {{1, 1, 1}, {1, 0, 1}, {1, 1, 0}}};
 
+// Fused expressions, see lazy_arithmetic.h.
+template <>
+inline constexpr auto stride_special_cases<4, false> =
+    std::array<std::array<scipp::index, 4>, 1>{{{1, 1, 1, 1}}};
+
+template <>
+inline constexpr auto stride_special_cases<5, false> =
+    std::array<std::array<scipp::index, 5>, 1>{{{1, 1, 1, 1, 1}}};
+
 template <size_t I, size_t N_Operands, bool in_place, size_t... Is>
 auto stride_sequence_impl(std::index_sequence<Is...>) -> std::integer_sequence<
     scipp::index, stride_special_cases<N_Operands, in_place>.at(I)[Is]...>;
@@ -179,21 +202,113 @@ static constexpr void call_in_place(Op &&op, const Indices &indices, Arg &&arg,
     arg.variances.data()[i] = arg_.variance;
   }
 }
+
+/// Raw pointer into the buffer of an operand without variances.
+template <class T> struct ContiguousValues {
+  T *values;
+  constexpr T &get(const scipp::index i) const noexcept { return values[i]; }
+  template <class V>
+  constexpr void set(const scipp::index, const V &) const noexcept {}
+};
+template <class T> ContiguousValues(T *) -> ContiguousValues<T>;
+
+/// Raw pointers into the buffers of an operand with variances.
+template <class T> struct ContiguousValuesAndVariances {
+  T *values;
+  T *variances;
+  constexpr auto get(const scipp::index i) const noexcept {
+    return ValueAndVariance{values[i], variances[i]};
+  }
+  template <class V>
+  constexpr void set(const scipp::index i, const V &x) const noexcept {
+    values[i] = x.value;
+    variances[i] = x.variance;
+  }
+};
+template <class T>
+ContiguousValuesAndVariances(T *, T *) -> ContiguousValuesAndVariances<T>;
+
+template <class T>
+static constexpr auto contiguous(T &&range, const scipp::index offset) {
+  if constexpr (has_variances_v<std::decay_t<T>>)
+    return ContiguousValuesAndVariances{range.values.data() + offset,
+                                        range.variances.data() + offset};
+  else
+    return ContiguousValues{range.data() + offset};
+}
+
+/// True if all operands have an arithmetic element type, i.e., they can be
+/// processed by `contiguous_inner_loop`.
+template <class... Operands>
+inline constexpr bool is_contiguous_loop_supported_v =
+    (std::is_arithmetic_v<typename std::decay_t<Operands>::value_type> && ...);
+
+/// Run transform on raw pointers with strides known at compile time.
+///
+/// This is equivalent to the loop over `call` or `call_in_place` but the
+/// pointers into the operand buffers are hoisted out of the loop. Without this
+/// the compiler cannot rule out that writes to the output alias the view
+/// parameters (e.g., the offset for int64 outputs), so element kernels such as
+/// those in core/element/arithmetic.h are not vectorized.
+template <bool in_place, class Op, class Out, class... Args,
+          scipp::index OutStride, scipp::index... Strides>
+static void
+contiguous_inner_loop(Op &&op,
+                      std::integer_sequence<scipp::index, OutStride, Strides...>,
+                      const scipp::index n, const Out out,
+                      const Args... args) {
+  for (scipp::index i = 0; i < n; ++i) {
+    auto &&out_ = out.get(OutStride * i);
+    if constexpr (in_place) {
+      static_assert(
+          std::is_same_v<decltype(op(out_, args.get(Strides * i)...)), void>);
+      op(out_, args.get(Strides * i)...);
+    } else {
+      out_ = op(args.get(Strides * i)...);
+    }
+    if constexpr (is_ValueAndVariance_v<std::decay_t<decltype(out_)>>)
+      out.set(OutStride * i, out_);
+  }
+}
+
+template <bool in_place, class Op, class... Operands, scipp::index... Strides,
+          size_t... I>
+static void
+dispatch_contiguous_inner_loop(Op &&op,
+                               const std::array<scipp::index, sizeof...(
+                                                                  Operands)>
+                                   &indices,
+                               std::integer_sequence<scipp::index, Strides...>
+                                   strides,
+                               std::index_sequence<I...>, const scipp::index n,
+                               Operands &&...operands) {
+  contiguous_inner_loop<in_place>(std::forward<Op>(op), strides, n,
+                                  contiguous(operands, indices[I])...);
+}
+
 /// Run transform with strides known at compile time.
 template <bool in_place, class Op, class... Operands, scipp::index... Strides>
 static void inner_loop(Op &&op,
                        std::array<scipp::index, sizeof...(Operands)> indices,
-                       std::integer_sequence<scipp::index, Strides...>,
+                       std::integer_sequence<scipp::index, Strides...> strides,
                        const scipp::index n, Operands &&...operands) {
   static_assert(sizeof...(Operands) == sizeof...(Strides));
 
-  for (scipp::index i = 0; i < n; ++i) {
-    if constexpr (in_place) {
-      detail::call_in_place(op, indices, std::forward<Operands>(operands)...);
-    } else {
-      detail::call(op, indices, std::forward<Operands>(operands)...);
+  if constexpr (is_contiguous_loop_supported_v<Operands...>) {
+    dispatch_contiguous_inner_loop<in_place>(
+        std::forward<Op>(op), indices, strides,
+        std::make_index_sequence<sizeof...(Operands)>{}, n,
+        std::forward<Operands>(operands)...);
+  } else {
+    for (scipp::index i = 0; i < n; ++i) {
+      if constexpr (in_place) {
+        detail::call_in_place(op, indices,
+                              std::forward<Operands>(operands)...);
+      } else {
+        detail::call(op, indices, std::forward<Operands>(operands)...);
+      }
+      detail::increment<Strides...>(indices);
     }
-    detail::increment<Strides...>(indices);
   }
 }
 
@@ -264,8 +379,16 @@ static void transform_elements(Op op, Out &&out, Ts &&...other) {
     end.set_index(range.end());
     run(indices, end);
   };
-  core::parallel::parallel_for(core::parallel::blocked_range(0, out.size()),
-                               run_parallel);
+  const auto range = core::parallel::blocked_range_by_work(
+      0, out.size(), (bytes_per_item(out) + ... + bytes_per_item(other)));
+  // Dense data is partitioned statically, such that repeated operations on the
+  // same data access it from the same threads. Bins may have very different
+  // sizes and require load balancing.
+  if (begin.has_bins())
+    core::parallel::parallel_for(range, run_parallel);
+  else
+    core::parallel::parallel_for(range, run_parallel,
+                                 core::parallel::static_partitioner{});
 }
 
 template <class T> static constexpr auto maybe_eval(T &&_) {
@@ -473,8 +596,13 @@ template <bool dry_run> struct in_place {
         end.set_index(range.end());
         run(indices, end);
       };
-      core::parallel::parallel_for(core::parallel::blocked_range(0, arg.size()),
-                                   run_parallel);
+      const auto range = core::parallel::blocked_range_by_work(
+          0, arg.size(), (bytes_per_item(arg) + ... + bytes_per_item(other)));
+      if (begin.has_bins())
+        core::parallel::parallel_for(range, run_parallel);
+      else
+        core::parallel::parallel_for(range, run_parallel,
+                                     core::parallel::static_partitioner{});
     }
   }
 
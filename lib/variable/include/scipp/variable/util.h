@@ -28,6 +28,12 @@ issorted(const Variable &x, const Dim dim,
 allsorted(const Variable &x, const Dim dim,
           const SortOrder order = SortOrder::Ascending);
 
+/// Classification of bin edges, see edge_kind.
+enum class EdgeKind { Linspace, Sorted, Unsorted };
+
+[[nodiscard]] SCIPP_VARIABLE_EXPORT EdgeKind edge_kind(const Variable &edges,
+                                                       const Dim dim);
+
 [[nodiscard]] SCIPP_VARIABLE_EXPORT Variable zip(const Variable &first,
                                                  const Variable &second);
 
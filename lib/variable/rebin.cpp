@@ -2,6 +2,8 @@
 // Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
 /// @file
 /// @author Simon Heybrock, Igor Gudich
+#include <vector>
+
 #include "scipp/core/element/rebin.h"
 #include "scipp/core/parallel.h"
 #include "scipp/units/except.h"
@@ -17,55 +19,142 @@ using namespace scipp::core::element;
 
 namespace scipp::variable {
 
-template <typename T, class Less>
-void rebin_non_inner(const Dim dim, const Variable &oldT,
-                     // cppcheck-suppress constParameter # bug in cppcheck
-                     Variable &newT, const Variable &oldCoord,
-                     const Variable &newCoord) {
-  if (oldCoord.ndim() != 1 || newCoord.ndim() != 1)
-    throw std::invalid_argument(
-        "Internal error in rebin, this should be unreachable.");
-  const auto oldSize = oldT.dims()[dim];
-  const auto newSize = newT.dims()[dim];
-
-  const auto *xold = oldCoord.values<T>().data();
-  const auto *xnew = newCoord.values<T>().data();
+namespace {
+/// Overlap of new bins with old bins as a sparse matrix in CSR layout.
+///
+/// Row `inew` holds the old bins `old_bin[k]` with weights `weight[k]` for
+/// `k` in [begin[inew], begin[inew + 1]). Each new bin overlaps few old bins,
+/// so the matrix is computed once and applied to all other dims.
+struct RebinWeights {
+  std::vector<scipp::index> begin;
+  std::vector<scipp::index> old_bin;
+  std::vector<double> weight;
+};
 
-  auto add_from_bin = [&](auto &&slice, const auto xn_low, const auto xn_high,
-                          const scipp::index iold) {
+template <typename T, class Less>
+RebinWeights make_rebin_weights(const T *xold, const scipp::index oldSize,
+                                const T *xnew, const scipp::index newSize) {
+  RebinWeights weights;
+  weights.begin.reserve(newSize + 1);
+  const auto add_from_bin = [&](const auto xn_low, const auto xn_high,
+                                const scipp::index iold) {
     auto xo_low = xold[iold];
     auto xo_high = xold[iold + 1];
     // delta is the overlap of the bins on the x axis
     const auto delta = std::abs(std::min<double>(xn_high, xo_high, Less{}) -
                                 std::max<double>(xn_low, xo_low, Less{}));
     const auto owidth = std::abs(xo_high - xo_low);
-    slice += oldT.slice({dim, iold}) *
-             ((delta / owidth) * (slice.unit() / oldT.unit()));
+    weights.old_bin.push_back(iold);
+    weights.weight.push_back(delta / owidth);
   };
-  auto accumulate_bin = [&](auto &&slice, const auto xn_low,
-                            const auto xn_high) {
+  for (scipp::index inew = 0; inew < newSize; ++inew) {
+    weights.begin.push_back(scipp::size(weights.old_bin));
+    const auto xn_low = xnew[inew];
+    const auto xn_high = xnew[inew + 1];
     scipp::index begin =
         std::upper_bound(xold, xold + oldSize + 1, xn_low, Less{}) - xold;
     scipp::index end =
         std::upper_bound(xold, xold + oldSize + 1, xn_high, Less{}) - xold;
     if (begin == oldSize + 1 || end == 0)
-      return;
+      continue;
     begin = std::max(scipp::index(0), begin - 1);
-    add_from_bin(slice, xn_low, xn_high, begin);
-    if (begin + 1 < end - 1)
-      sum_into(slice, oldT.slice({dim, begin + 1, end - 1}));
-    if (begin != end - 1 && end < oldSize + 1)
-      add_from_bin(slice, xn_low, xn_high, end - 1);
-  };
-  auto accumulate_bins = [&](const auto &range) {
-    for (scipp::index inew = range.begin(); inew < range.end(); ++inew) {
-      auto xn_low = xnew[inew];
-      auto xn_high = xnew[inew + 1];
-      accumulate_bin(newT.slice({dim, inew}), xn_low, xn_high);
+    add_from_bin(xn_low, xn_high, begin);
+    for (scipp::index iold = begin + 1; iold < end - 1; ++iold) {
+      weights.old_bin.push_back(iold);
+      weights.weight.push_back(1.0);
     }
-  };
-  core::parallel::parallel_for(core::parallel::blocked_range(0, newSize),
-                               accumulate_bins);
+    if (begin != end - 1 && end < oldSize + 1)
+      add_from_bin(xn_low, xn_high, end - 1);
+  }
+  weights.begin.push_back(scipp::size(weights.old_bin));
+  return weights;
+}
+
+/// Apply `weights` to contiguous `in` with dims [outer, old bins, inner],
+/// adding to `out` with dims [outer, new bins, inner].
+///
+/// Rows of `out` are processed in parallel, the loop over `inner` is
+/// contiguous. Weights are squared for variances.
+template <class Out, class In>
+void apply_rebin_weights(const RebinWeights &weights, const In *in, Out *out,
+                         const scipp::index nouter, const scipp::index oldSize,
+                         const scipp::index newSize, const scipp::index inner,
+                         const bool variances) {
+  core::parallel::parallel_for(
+      core::parallel::blocked_range_by_work(0, nouter * newSize,
+                                            2 * sizeof(Out) * inner),
+      [&](const auto &range) {
+        for (auto row = range.begin(); row < range.end(); ++row) {
+          const auto outer = row / newSize;
+          const auto inew = row % newSize;
+          Out *dst = out + row * inner;
+          for (auto k = weights.begin[inew]; k < weights.begin[inew + 1];
+               ++k) {
+            const In *src = in + (outer * oldSize + weights.old_bin[k]) * inner;
+            const auto w = variances ? weights.weight[k] * weights.weight[k]
+                                     : weights.weight[k];
+            for (scipp::index i = 0; i < inner; ++i)
+              dst[i] += static_cast<Out>(src[i] * w);
+          }
+        }
+      },
+      core::parallel::static_partitioner{});
+}
+
+template <class Out, class In>
+void apply_rebin_weights(const RebinWeights &weights, const Dim dim,
+                         const Variable &oldT, Variable &newT) {
+  const auto oldSize = oldT.dims()[dim];
+  const auto newSize = newT.dims()[dim];
+  const auto inner = oldT.stride(dim);
+  if (oldT.dims().volume() == 0 || newT.dims().volume() == 0)
+    return;
+  const auto nouter = oldT.dims().volume() / (oldSize * inner);
+  apply_rebin_weights(weights, oldT.values<In>().data(),
+                      newT.values<Out>().data(), nouter, oldSize, newSize,
+                      inner, false);
+  if constexpr (std::is_floating_point_v<In>)
+    if (oldT.has_variances())
+      apply_rebin_weights(weights, oldT.variances<In>().data(),
+                          newT.variances<Out>().data(), nouter, oldSize,
+                          newSize, inner, true);
+}
+} // namespace
+
+/// Rebin `oldT` along `dim` into `newT` if `dim` is not the inner dimension.
+///
+/// The overlap of old and new bins is computed once and applied to all slices
+/// along the other dimensions, using contiguous loops over the inner dims.
+template <typename T, class Less>
+void rebin_non_inner(const Dim dim, const Variable &oldT,
+                     // cppcheck-suppress constParameter # bug in cppcheck
+                     Variable &newT, const Variable &oldCoord,
+                     const Variable &newCoord) {
+  if (oldCoord.ndim() != 1 || newCoord.ndim() != 1)
+    throw std::invalid_argument(
+        "Internal error in rebin, this should be unreachable.");
+  const auto oldSize = oldT.dims()[dim];
+  const auto newSize = newT.dims()[dim];
+  const auto weights = make_rebin_weights<T, Less>(
+      oldCoord.values<T>().data(), oldSize, newCoord.values<T>().data(),
+      newSize);
+  // The kernel requires the memory order of the dims to match.
+  const auto in = core::Strides(oldT.dims()) == core::Strides(oldT.strides())
+                      ? oldT
+                      : copy(oldT);
+  if (in.dtype() == dtype<double>)
+    apply_rebin_weights<double, double>(weights, dim, in, newT);
+  else if (in.dtype() == dtype<float>)
+    apply_rebin_weights<float, float>(weights, dim, in, newT);
+  else if (in.dtype() == dtype<int64_t>)
+    apply_rebin_weights<double, int64_t>(weights, dim, in, newT);
+  else if (in.dtype() == dtype<int32_t>)
+    apply_rebin_weights<double, int32_t>(weights, dim, in, newT);
+  else if (in.dtype() == dtype<bool>)
+    apply_rebin_weights<double, bool>(weights, dim, in, newT);
+  else
+    throw except::TypeError("Cannot rebin data of dtype " +
+                            to_string(in.dtype()));
 }
 
 namespace {
@@ -2,11 +2,18 @@
 // Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
 /// @file
 /// @author Simon Heybrock
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
 #include "scipp/variable/reduction.h"
 #include "scipp/core/dtype.h"
 #include "scipp/core/element/arithmetic.h"
 #include "scipp/core/element/comparison.h"
 #include "scipp/core/element/logical.h"
+#include "scipp/core/except.h"
+#include "scipp/core/parallel.h"
+#include "scipp/core/tag_util.h"
 #include "scipp/variable/accumulate.h"
 #include "scipp/variable/arithmetic.h"
 #include "scipp/variable/astype.h"
@@ -65,6 +72,129 @@ Variable nansum(const Variable &var, const Dim dim) {
   return reduce_dim(var, dim, nansum_into, FillValue::ZeroNotBool);
 }
 
+namespace {
+/// Deterministic sum of a contiguous array with shape (outer, size, inner)
+/// along the middle axis.
+///
+/// The middle axis is split into blocks of fixed size which are summed
+/// sequentially. The block sums are then combined pairwise. Neither step
+/// depends on how the work is distributed among threads, so the result is
+/// bitwise reproducible. The rounding error grows only logarithmically with
+/// the number of blocks, in contrast to linearly with the number of elements.
+template <class T> struct PairwiseSum {
+  // float is accumulated in double, as in sum_into.
+  using Acc = std::conditional_t<std::is_same_v<T, float>, double, T>;
+  static constexpr scipp::index block_size = 128;
+  static constexpr scipp::index lane_block = 1024;
+
+  const T *data;
+  scipp::index outer;
+  scipp::index size;
+  scipp::index inner;
+
+  void operator()(T *out) const {
+    if (outer * inner == 0)
+      return;
+    const auto nblock =
+        std::max(scipp::index(1), (size + block_size - 1) / block_size);
+    // sums[(o * nblock + block) * inner + j]
+    std::vector<Acc> sums(outer * nblock * inner, Acc{0});
+    core::parallel::parallel_for(
+        core::parallel::blocked_range_by_work(0, outer * nblock,
+                                              sizeof(T) * block_size * inner),
+        [&](const auto &range) {
+          for (auto task = range.begin(); task != range.end(); ++task) {
+            const auto o = task / nblock;
+            const auto begin = task % nblock * block_size;
+            const auto end = std::min(begin + block_size, size);
+            Acc *sum = sums.data() + task * inner;
+            for (auto i = begin; i < end; ++i) {
+              const T *row = data + (o * size + i) * inner;
+              for (scipp::index j = 0; j < inner; ++j)
+                sum[j] += row[j];
+            }
+          }
+        });
+    const auto nlane_block = (inner + lane_block - 1) / lane_block;
+    core::parallel::parallel_for(
+        core::parallel::blocked_range(0, outer * nlane_block),
+        [&](const auto &range) {
+          for (auto task = range.begin(); task != range.end(); ++task) {
+            const auto o = task / nlane_block;
+            const auto j0 = task % nlane_block * lane_block;
+            const auto n = std::min(lane_block, inner - j0);
+            Acc *sum = sums.data() + o * nblock * inner + j0;
+            combine(sum, 0, nblock, n);
+            for (scipp::index j = 0; j < n; ++j)
+              out[o * inner + j0 + j] = static_cast<T>(sum[j]);
+          }
+        });
+  }
+
+  /// Add the sums of blocks [begin, end) of `n` lanes pairwise into block
+  /// `begin`.
+  void combine(Acc *sum, const scipp::index begin, const scipp::index end,
+               const scipp::index n) const {
+    if (end - begin < 2)
+      return;
+    const auto mid = begin + (end - begin) / 2;
+    combine(sum, begin, mid, n);
+    combine(sum, mid, end, n);
+    Acc *a = sum + begin * inner;
+    const Acc *b = sum + mid * inner;
+    for (scipp::index j = 0; j < n; ++j)
+      a[j] += b[j];
+  }
+};
+
+template <class T> struct SumContiguous {
+  static void apply(const Variable &var, Variable &out,
+                    const scipp::index outer, const scipp::index size,
+                    const scipp::index inner) {
+    PairwiseSum<T>{var.values<T>().data(), outer, size, inner}(
+        out.values<T>().data());
+    if (var.has_variances())
+      PairwiseSum<T>{var.variances<T>().data(), outer, size, inner}(
+          out.variances<T>().data());
+  }
+};
+} // namespace
+
+/// Return the sum along given dimension using the given summation algorithm.
+///
+/// With SumMode::Deterministic floating-point data is summed pairwise in
+/// blocks of fixed size, giving results that are bitwise reproducible
+/// regardless of the number of threads. This is also more precise than the
+/// default algorithm for long reduction dimensions. Integer and bool data is
+/// summed exactly in any case, other dtypes and binned data are not supported
+/// in this mode.
+Variable sum(const Variable &var, const Dim dim, const SumMode mode) {
+  const auto type = var.dtype();
+  if (mode == SumMode::Default || type == dtype<int64_t> ||
+      type == dtype<int32_t> || type == dtype<bool>)
+    return sum(var, dim);
+  if (is_bins(var) || (type != dtype<double> && type != dtype<float>))
+    throw except::TypeError("Deterministic sum is not supported for dtype " +
+                            to_string(type) + '.');
+  const auto &in_dims = var.dims();
+  const auto size = in_dims[dim];
+  scipp::index outer = 1;
+  scipp::index inner = 1;
+  for (scipp::index i = 0; i < in_dims.ndim(); ++i)
+    if (i < in_dims.index(dim))
+      outer *= in_dims.size(i);
+    else if (i > in_dims.index(dim))
+      inner *= in_dims.size(i);
+  const auto contiguous =
+      Strides(var.strides()) == Strides(in_dims) ? var : copy(var);
+  auto dims = in_dims;
+  dims.erase(dim);
+  Variable out(var, dims);
+  core::CallDType<double, float>::apply<SumContiguous>(type, contiguous, out,
+                                                       outer, size, inner);
+  return out;
+}
+
 Variable any(const Variable &var, const Dim dim) {
   return reduce_dim(var, dim, any_into, FillValue::False);
 }
@@ -157,11 +287,259 @@ Variable nanmean(const Variable &var, const Dim dim) {
   return nanmean_impl(var, dim, sum(isfinite(var), dim));
 }
 
+namespace {
+/// Accumulators for `reduce_many`. Invalid if not required.
+struct ReduceManyAccumulators {
+  Variable sum;
+  Variable min;
+  Variable max;
+
+  [[nodiscard]] ReduceManyAccumulators slice(const Slice &s) const {
+    return {sum.is_valid() ? sum.slice(s) : sum,
+            min.is_valid() ? min.slice(s) : min,
+            max.is_valid() ? max.slice(s) : max};
+  }
+};
+
+// Number of input elements processed by all accumulators in turn, chosen such
+// that a block stays in L1 or L2 cache while it is read by each accumulator.
+// This is below the threshold at which `accumulate_in_place` would use
+// threading, so each block is processed serially.
+constexpr scipp::index reduce_many_block_volume = 8192;
+
+// Maximum number of partial results when reducing the outer dimension.
+constexpr scipp::index reduce_many_max_chunks = 64;
+
+Variable hide_masked(const Variable &var, const Variable &mask,
+                     const FillValue fill) {
+  if (!mask.is_valid())
+    return var;
+  return where(mask, dense_special_like(var, Dimensions{}, fill), var);
+}
+
+void reduce_block(ReduceManyAccumulators accum, const Variable &var,
+                  const Variable &mask) {
+  if (mask.is_valid()) {
+    // The kernels skip masked elements, so the block is shared by all
+    // accumulators instead of making a copy with masked elements replaced.
+    if (accum.sum.is_valid())
+      accumulate_in_place(accum.sum, var, mask, element::masked_add_equals,
+                          "sum");
+    if (accum.min.is_valid())
+      accumulate_in_place(accum.min, var, mask, element::masked_min_equals,
+                          "min");
+    if (accum.max.is_valid())
+      accumulate_in_place(accum.max, var, mask, element::masked_max_equals,
+                          "max");
+    return;
+  }
+  if (accum.sum.is_valid())
+    accumulate_in_place(accum.sum, var, element::add_equals, "sum");
+  if (accum.min.is_valid())
+    accumulate_in_place(accum.min, var, element::min_equals, "min");
+  if (accum.max.is_valid())
+    accumulate_in_place(accum.max, var, element::max_equals, "max");
+}
+
+/// Apply all accumulators to cache-sized blocks of `var`, sliced along its
+/// outer dimensions.
+void reduce_blocks(ReduceManyAccumulators accum, const Variable &var,
+                   const Variable &mask, const Dim dim) {
+  const auto volume = var.dims().volume();
+  if (volume <= reduce_many_block_volume)
+    return reduce_block(accum, var, mask);
+  const auto outer = var.dims().label(0);
+  const auto size = var.dims()[outer];
+  const auto step =
+      std::max(scipp::index(1), size * reduce_many_block_volume / volume);
+  for (scipp::index begin = 0; begin < size; begin += step) {
+    // Slice to a single element if a block spans less than one outer slice,
+    // such that the next level of recursion proceeds to the next dimension.
+    const auto s = step == 1
+                       ? Slice(outer, begin)
+                       : Slice(outer, begin, std::min(begin + step, size));
+    reduce_blocks(outer == dim ? accum : accum.slice(s), var.slice(s),
+                  mask.is_valid() ? mask.slice(s) : mask, dim);
+  }
+}
+
+void combine(ReduceManyAccumulators accum,
+             const ReduceManyAccumulators &partial) {
+  if (accum.sum.is_valid())
+    accumulate_in_place(accum.sum, partial.sum, element::add_equals, "sum");
+  if (accum.min.is_valid())
+    accumulate_in_place(accum.min, partial.min, element::min_equals, "min");
+  if (accum.max.is_valid())
+    accumulate_in_place(accum.max, partial.max, element::max_equals, "max");
+}
+
+ReduceManyAccumulators copy_accumulators(const ReduceManyAccumulators &accum) {
+  return {accum.sum.is_valid() ? copy(accum.sum) : accum.sum,
+          accum.min.is_valid() ? copy(accum.min) : accum.min,
+          accum.max.is_valid() ? copy(accum.max) : accum.max};
+}
+
+void reduce_parallel(const ReduceManyAccumulators &accum, const Variable &var,
+                     const Variable &mask, const Dim dim) {
+  if (var.dims().volume() <= reduce_many_block_volume)
+    return reduce_block(accum, var, mask);
+  const auto outer = var.dims().label(0);
+  const auto size = var.dims()[outer];
+  const auto slice = [&](const Variable &v, const scipp::index begin,
+                         const scipp::index end) {
+    return v.is_valid() ? v.slice({outer, begin, end}) : v;
+  };
+  if (outer != dim) {
+    // Threads write to disjoint slices of the output.
+    core::parallel::parallel_for(
+        core::parallel::blocked_range(0, size), [&](const auto &range) {
+          reduce_blocks(accum.slice({outer, range.begin(), range.end()}),
+                        slice(var, range.begin(), range.end()),
+                        slice(mask, range.begin(), range.end()), dim);
+        });
+    return;
+  }
+  // Reducing the outer dimension: Every chunk of the input is accumulated into
+  // private partial results, which are combined in order at the end. This
+  // relies on the initial values of the accumulators being the identity of the
+  // operations. The number of chunks depends only on the shape of the input,
+  // not on the number of threads, so floating-point sums are reproducible.
+  const auto nchunk =
+      std::min({size, reduce_many_max_chunks,
+                std::max(scipp::index(1),
+                         var.dims().volume() / reduce_many_block_volume)});
+  std::vector<ReduceManyAccumulators> partial;
+  for (scipp::index i = 0; i < nchunk; ++i)
+    partial.emplace_back(copy_accumulators(accum));
+  core::parallel::parallel_for(
+      core::parallel::blocked_range(0, nchunk, 1), [&](const auto &range) {
+        for (scipp::index i = range.begin(); i < range.end(); ++i) {
+          const auto begin = size * i / nchunk;
+          const auto end = size * (i + 1) / nchunk;
+          reduce_blocks(partial[i], slice(var, begin, end),
+                        slice(mask, begin, end), dim);
+        }
+      });
+  for (const auto &p : partial)
+    combine(accum, p);
+}
+
+Variable count_unmasked(const Variable &var, const Dim dim,
+                        const Variable &mask) {
+  if (!mask.is_valid())
+    return count(var, dim);
+  if (is_bins(var)) {
+    const auto sizes = bins_count(var);
+    return sum(where(mask, zero_like(sizes), sizes), dim);
+  }
+  return sum(~mask, dim);
+}
+
+bool can_reduce_many_in_one_pass(const Variable &var) {
+  if (is_bins(var) || var.dims().ndim() == 0)
+    return false;
+  const auto type = var.dtype();
+  return type == dtype<double> || type == dtype<float> ||
+         type == dtype<int64_t> || type == dtype<int32_t>;
+}
+
+Variable reduce_separately(const Variable &var, const Dim dim,
+                           const Reduction reduction, const Variable &mask) {
+  switch (reduction) {
+  case Reduction::Sum:
+    return sum(hide_masked(var, mask, FillValue::Default), dim);
+  case Reduction::Min:
+    return min(hide_masked(var, mask, FillValue::Max), dim);
+  case Reduction::Max:
+    return max(hide_masked(var, mask, FillValue::Lowest), dim);
+  default:
+    throw std::runtime_error("Unsupported reduction.");
+  }
+}
+} // namespace
+
+/// Compute several reductions along `dim` in a single pass over `var`.
+///
+/// Returns the results in the order given by `reductions`. The sum, minimum,
+/// and maximum are accumulated together, processing the input in cache-sized
+/// blocks, such that the input is read from memory only once. `Mean` and
+/// `Count` are derived from the sum and the number of (unmasked) elements.
+/// The results are equivalent to calling `sum`, `mean`, `min`, and `max`
+/// individually. Elements where `mask` (if given) is true are ignored, as
+/// for data arrays with masks. Binned variables and dtypes other than
+/// floating-point and integer types are supported by falling back to
+/// individual reductions.
+std::vector<Variable> reduce_many(const Variable &var, const Dim dim,
+                                  const std::vector<Reduction> &reductions,
+                                  const Variable &mask) {
+  const auto requested = [&](const auto... r) {
+    return ((std::find(reductions.begin(), reductions.end(), r) !=
+             reductions.end()) ||
+            ...);
+  };
+  auto out_dims = var.dims();
+  out_dims.erase(dim);
+  const auto counts = count_unmasked(var, dim, mask);
+
+  std::vector<Variable> partial(3);
+  if (can_reduce_many_in_one_pass(var)) {
+    ReduceManyAccumulators accum;
+    if (requested(Reduction::Sum, Reduction::Mean))
+      accum.sum = dense_special_like(var, out_dims, FillValue::Default);
+    if (accum.sum.is_valid() && accum.sum.dtype() == dtype<float>)
+      accum.sum = astype(accum.sum, dtype<double>);
+    if (requested(Reduction::Min))
+      accum.min = dense_special_like(var, out_dims, FillValue::Max);
+    if (requested(Reduction::Max))
+      accum.max = dense_special_like(var, out_dims, FillValue::Lowest);
+    reduce_parallel(accum, var,
+                    mask.is_valid() ? broadcast(mask, var.dims()) : mask, dim);
+    partial = {accum.sum.is_valid() ? astype(accum.sum, var.dtype(),
+                                             CopyPolicy::TryAvoid)
+                                    : accum.sum,
+               accum.min, accum.max};
+  } else {
+    if (requested(Reduction::Sum, Reduction::Mean))
+      partial[0] = reduce_separately(var, dim, Reduction::Sum, mask);
+    if (requested(Reduction::Min))
+      partial[1] = reduce_separately(var, dim, Reduction::Min, mask);
+    if (requested(Reduction::Max))
+      partial[2] = reduce_separately(var, dim, Reduction::Max, mask);
+  }
+
+  std::vector<Variable> results;
+  for (const auto reduction : reductions) {
+    switch (reduction) {
+    case Reduction::Sum:
+      results.emplace_back(partial[0]);
+      break;
+    case Reduction::Mean:
+      results.emplace_back(normalize_impl(partial[0], copy(counts)));
+      break;
+    case Reduction::Min:
+      results.emplace_back(partial[1]);
+      break;
+    case Reduction::Max:
+      results.emplace_back(partial[2]);
+      break;
+    case Reduction::Count:
+      results.emplace_back(copy(broadcast(counts, out_dims)));
+      break;
+    }
+  }
+  return results;
+}
+
 /// Return the sum along all dimensions.
 Variable sum(const Variable &var) {
   return reduce_all_dims(var, [](auto &&..._) { return sum(_...); });
 }
 
+/// Return the sum along all dimensions using the given summation algorithm.
+Variable sum(const Variable &var, const SumMode mode) {
+  return reduce_all_dims(var, [mode](auto &&..._) { return sum(_..., mode); });
+}
+
 /// Return the sum along all dimensions, nans treated as zero.
 Variable nansum(const Variable &var) {
   return reduce_all_dims(var, [](auto &&..._) { return nansum(_...); });
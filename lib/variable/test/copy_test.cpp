@@ -2,6 +2,9 @@
 // Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
 #include <gtest/gtest.h>
 
+#include <numeric>
+#include <vector>
+
 #include "test_macros.h"
 
 #include "scipp/core/except.h"
@@ -85,3 +88,25 @@ TEST_F(CopyTest, broadcast_transpose_slice) {
   EXPECT_EQ(copied.data().size(), 8);
   EXPECT_TRUE(equals(var.values<double>(), {5, 8, 5, 8, 6, 9, 6, 9}));
 }
+
+TEST_F(CopyTest, transpose_large) {
+  // Large enough for multiple tiles in the innermost dims.
+  const Dimensions dims({Dim::Z, Dim::Y, Dim::X}, {3, 40, 70});
+  std::vector<double> values(dims.volume());
+  std::iota(values.begin(), values.end(), 0.0);
+  const auto xyz = makeVariable<double>(dims, units::m, Values(values),
+                                        Variances(values));
+  for (const auto &order : {std::vector<Dim>{Dim::Z, Dim::X, Dim::Y},
+                            std::vector<Dim>{Dim::X, Dim::Y, Dim::Z},
+                            std::vector<Dim>{Dim::Y, Dim::X, Dim::Z}}) {
+    const auto var = transpose(xyz, order);
+    check_copied(copy(var), var);
+  }
+}
+
+TEST_F(CopyTest, into_transposed_slice) {
+  auto target = makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{3, 4},
+                                     units::m, Values{}, Variances{});
+  copy(xy, target.slice({Dim::X, 1, 4}));
+  EXPECT_EQ(target.slice({Dim::X, 1, 4}), transpose(xy));
+}
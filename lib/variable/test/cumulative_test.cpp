@@ -62,3 +62,78 @@ TEST_F(CumulativePrecisionTest, cumsum_bins) {
   expected = flatten(expected, std::vector<Dim>{Dim::X, Dim::Y}, Dim::Row);
   EXPECT_EQ(cumsum_bins(var), make_bins(indices, Dim::Row, expected));
 }
+
+class CumulativeLargeTest : public ::testing::Test {
+protected:
+  // Large enough for threading, with many and with few independent lanes.
+  Variable var = make(Dimensions({Dim::X, Dim::Y}, {1000, 300}));
+
+  static Variable make(const Dimensions &dims) {
+    std::vector<int64_t> values(dims.volume());
+    for (scipp::index i = 0; i < dims.volume(); ++i)
+      values[i] = i % 7 - 2;
+    return makeVariable<int64_t>(dims, Values(values));
+  }
+
+  // Reference implementation along `dim` of a 2-D variable.
+  static Variable expected(const Variable &var, const Dim dim,
+                           const CumSumMode mode) {
+    auto out = copy(var);
+    const auto other = var.dims().label(0) == dim ? var.dims().label(1)
+                                                  : var.dims().label(0);
+    for (scipp::index j = 0; j < var.dims()[other]; ++j) {
+      auto lane = out.slice({other, j});
+      int64_t sum = 0;
+      for (auto &x : lane.values<int64_t>()) {
+        sum += x;
+        x = mode == CumSumMode::Inclusive ? sum : sum - x;
+      }
+    }
+    return out;
+  }
+};
+
+TEST_F(CumulativeLargeTest, cumsum_inner) {
+  for (const auto mode : {CumSumMode::Inclusive, CumSumMode::Exclusive})
+    EXPECT_EQ(cumsum(var, Dim::Y, mode), expected(var, Dim::Y, mode));
+}
+
+TEST_F(CumulativeLargeTest, cumsum_outer) {
+  for (const auto mode : {CumSumMode::Inclusive, CumSumMode::Exclusive})
+    EXPECT_EQ(cumsum(var, Dim::X, mode), expected(var, Dim::X, mode));
+}
+
+TEST_F(CumulativeLargeTest, cumsum_transposed) {
+  EXPECT_EQ(cumsum(transpose(var), Dim::X),
+            transpose(expected(var, Dim::X, CumSumMode::Inclusive)));
+}
+
+TEST_F(CumulativeLargeTest, cumsum_all) {
+  const auto flat = flatten(var, std::vector<Dim>{Dim::X, Dim::Y}, Dim::Row);
+  auto expected_flat = copy(flat);
+  int64_t sum = 0;
+  for (auto &x : expected_flat.values<int64_t>()) {
+    sum += x;
+    x = sum;
+  }
+  EXPECT_EQ(cumsum(var), fold(expected_flat, Dim::Row, var.dims()));
+}
+
+TEST_F(CumulativeLargeTest, cumsum_bins) {
+  const auto buffer = flatten(var, std::vector<Dim>{Dim::X, Dim::Y}, Dim::Row);
+  const auto indices = makeVariable<scipp::index_pair>(
+      Dims{Dim::X}, Shape{3},
+      Values{scipp::index_pair{0, 1000}, scipp::index_pair{1000, 1000},
+             scipp::index_pair{1200, 300000}});
+  auto expected_buffer = copy(buffer);
+  for (const auto &[begin, end] : indices.values<scipp::index_pair>()) {
+    int64_t sum = 0;
+    for (auto &x : expected_buffer.slice({Dim::Row, begin, end})
+                       .values<int64_t>()) {
+      sum += x;
+      x = sum;
+    }
+  }
+  EXPECT_EQ(cumsum_bins(make_bins(indices, Dim::Row, buffer)),
+            make_bins(indices, Dim::Row, expected_buffer));
+}
@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include "test_macros.h"
+
+#include "scipp/variable/arithmetic.h"
+#include "scipp/variable/lazy_arithmetic.h"
+#include "scipp/variable/shape.h"
+
+using namespace scipp;
+
+class LazyArithmeticTest : public ::testing::Test {
+protected:
+  Variable a = makeVariable<double>(Dims{Dim::X}, Shape{3}, units::m,
+                                    Values{1.0, 2.0, 3.0},
+                                    Variances{0.1, 0.2, 0.3});
+  Variable b = makeVariable<double>(Dims{Dim::Y}, Shape{2}, units::s,
+                                    Values{4.0, 5.0});
+  Variable c = makeVariable<double>(Dims{Dim::X}, Shape{3}, units::m * units::s,
+                                    Values{6.0, 7.0, 8.0},
+                                    Variances{0.6, 0.7, 0.8});
+  Variable d = makeVariable<double>(Values{2.0}, Variances{0.5});
+};
+
+TEST_F(LazyArithmeticTest, single_leaf) {
+  const Variable result = lazy::expr(a);
+  EXPECT_EQ(result, a);
+}
+
+TEST_F(LazyArithmeticTest, binary) {
+  const auto a2 = copy(a);
+  EXPECT_EQ(Variable(lazy::expr(a) + a2), a + a2);
+  EXPECT_EQ(Variable(lazy::expr(a) - c / b), a - c / b);
+  EXPECT_EQ(Variable(lazy::expr(a) * b), a * b);
+  EXPECT_EQ(Variable(lazy::expr(a) / b), a / b);
+}
+
+TEST_F(LazyArithmeticTest, chained_matches_eager) {
+  const Variable result = lazy::expr(a) * b + c / d;
+  EXPECT_EQ(result, a * b + c / d);
+  EXPECT_EQ(result.dims(), (Dimensions{{Dim::X, 3}, {Dim::Y, 2}}));
+  EXPECT_EQ(result.unit(), units::m * units::s);
+}
+
+TEST_F(LazyArithmeticTest, expression_on_right_hand_side) {
+  EXPECT_EQ(lazy::evaluate(c - lazy::expr(a) * b), c - a * b);
+  EXPECT_EQ(lazy::evaluate((lazy::expr(a) * b) / (lazy::expr(c) * d)),
+            (a * b) / (c * d));
+}
+
+TEST_F(LazyArithmeticTest, transposed_and_sliced_inputs) {
+  const auto ab = a * b;
+  const auto t = transpose(ab);
+  EXPECT_EQ(lazy::evaluate(lazy::expr(t) + ab), t + ab);
+  EXPECT_EQ(lazy::evaluate(lazy::expr(t.slice({Dim::Y, 1})) * d),
+            t.slice({Dim::Y, 1}) * d);
+}
+
+TEST_F(LazyArithmeticTest, unit_error) {
+  EXPECT_THROW_DISCARD(lazy::evaluate(lazy::expr(a) + b), except::UnitError);
+}
+
+TEST_F(LazyArithmeticTest, correlated_inputs_fall_back_to_eager) {
+  EXPECT_EQ(lazy::evaluate(lazy::expr(a) + a), a + a);
+  EXPECT_EQ(lazy::evaluate(lazy::expr(a) * a), a * a);
+  EXPECT_EQ(lazy::evaluate(lazy::expr(a) - a), a - a);
+}
+
+TEST_F(LazyArithmeticTest, mixed_dtypes_fall_back_to_eager) {
+  const auto i = makeVariable<int64_t>(Dims{Dim::X}, Shape{3}, units::s,
+                                       Values{1, 2, 3});
+  const auto f = makeVariable<float>(Dims{Dim::X}, Shape{3}, units::m,
+                                     Values{1.0f, 2.0f, 3.0f});
+  EXPECT_EQ(lazy::evaluate(lazy::expr(a) * i + c), a * i + c);
+  EXPECT_EQ(lazy::evaluate(lazy::expr(f) * b + a * b), f * b + a * b);
+}
+
+TEST_F(LazyArithmeticTest, float) {
+  const auto f = makeVariable<float>(Dims{Dim::X}, Shape{3}, units::m,
+                                     Values{1.0f, 2.0f, 3.0f},
+                                     Variances{1.0f, 1.0f, 1.0f});
+  const auto g = makeVariable<float>(Dims{Dim::Y}, Shape{2}, units::m,
+                                     Values{1.5f, 2.5f});
+  const auto h = makeVariable<float>(units::m * units::m, Values{0.5f});
+  const Variable result = lazy::expr(f) * g - h;
+  EXPECT_EQ(result.dtype(), dtype<float>);
+  EXPECT_EQ(result, f * g - h);
+}
@@ -5,6 +5,7 @@
 #include "scipp/variable/astype.h"
 #include "scipp/variable/bins.h"
 #include "scipp/variable/rebin.h"
+#include "scipp/variable/shape.h"
 #include "scipp/variable/variable.h"
 
 #include "test_macros.h"
@@ -63,6 +64,27 @@ TEST(RebinTest, outer) {
   }
 }
 
+TEST(RebinTest, outer_with_variances_and_inner_dims) {
+  const auto var = makeVariable<double>(
+      Dims{Dim::Z, Dim::Y, Dim::X}, Shape{2, 4, 2}, units::counts,
+      Values{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16},
+      Variances{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16});
+  const auto oldEdge =
+      makeVariable<double>(Dims{Dim::Y}, Shape{5}, Values{0, 1, 2, 3, 4});
+  const auto newEdge =
+      makeVariable<double>(Dims{Dim::Y}, Shape{3}, Values{0.5, 2.5, 5.0});
+  // Partially overlapped bins contribute with the overlap fraction to the
+  // values and with its square to the variances.
+  const auto expected = makeVariable<double>(
+      Dims{Dim::Z, Dim::Y, Dim::X}, Shape{2, 2, 2}, units::counts,
+      Values{6.0, 8.0, 9.5, 11.0, 22.0, 24.0, 21.5, 23.0},
+      Variances{4.5, 6.0, 8.25, 9.5, 16.5, 18.0, 18.25, 19.5});
+  EXPECT_EQ(rebin(var, Dim::Y, oldEdge, newEdge), expected);
+  // Non-contiguous input gives the same result.
+  const auto transposed = transpose(copy(transpose(var)));
+  EXPECT_EQ(rebin(transposed, Dim::Y, oldEdge, newEdge), expected);
+}
+
 // Code in this test uses a different branch in rebin compared to
 // outer_increasing_2_inner because rebin uses an optimization
 // for stride[rebin_dim] == 1.
@@ -0,0 +1,158 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "test_macros.h"
+
+#include "scipp/core/except.h"
+#include "scipp/core/parallel.h"
+#include "scipp/variable/astype.h"
+#include "scipp/variable/comparison.h"
+#include "scipp/variable/math.h"
+#include "scipp/variable/reduction.h"
+#include "scipp/variable/shape.h"
+#include "scipp/variable/util.h"
+#include "scipp/variable/variable.h"
+
+using namespace scipp;
+
+namespace {
+const std::vector<Reduction> all_reductions{Reduction::Sum, Reduction::Mean,
+                                            Reduction::Min, Reduction::Max,
+                                            Reduction::Count};
+
+void expect_matches_individual(const Variable &var, const Dim dim) {
+  const auto results = reduce_many(var, dim, all_reductions);
+  ASSERT_EQ(results.size(), 5);
+  EXPECT_EQ(results[0], sum(var, dim));
+  EXPECT_TRUE(equals_nan(results[1], mean(var, dim)));
+  EXPECT_EQ(results[2], min(var, dim));
+  EXPECT_EQ(results[3], max(var, dim));
+  auto out_dims = var.dims();
+  out_dims.erase(dim);
+  EXPECT_EQ(results[4], copy(broadcast(var.dims()[dim] * units::none,
+                                       out_dims)));
+}
+
+Variable make_large(const DType type, const bool variances) {
+  // Large enough for many blocks and threading in both code paths.
+  const Dimensions dims({Dim::Z, Dim::Y, Dim::X}, {7, 60, 300});
+  std::vector<double> values(dims.volume());
+  std::iota(values.begin(), values.end(), 0.0);
+  // Small integers such that all sums are exact irrespective of order.
+  for (auto &x : values)
+    x = static_cast<double>(static_cast<int64_t>(x * 7919) % 101) - 50.0;
+  const auto var = variances ? makeVariable<double>(dims, units::m,
+                                                    Values(values),
+                                                    Variances(values))
+                             : makeVariable<double>(dims, units::m,
+                                                    Values(values));
+  return astype(variances ? abs(var) : var, type);
+}
+} // namespace
+
+TEST(ReduceManyTest, fails_with_bad_dim) {
+  const auto var = makeVariable<double>(Dims{Dim::X}, Shape{2});
+  EXPECT_THROW_DISCARD(reduce_many(var, Dim::Y, all_reductions),
+                       except::DimensionError);
+}
+
+TEST(ReduceManyTest, results_in_requested_order) {
+  const auto var = makeVariable<double>(Dims{Dim::X, Dim::Y}, Shape{2, 2},
+                                        units::m, Values{1, 2, 3, 4});
+  const auto results =
+      reduce_many(var, Dim::X, {Reduction::Max, Reduction::Sum});
+  ASSERT_EQ(results.size(), 2);
+  EXPECT_EQ(results[0], max(var, Dim::X));
+  EXPECT_EQ(results[1], sum(var, Dim::X));
+}
+
+TEST(ReduceManyTest, small) {
+  const auto var = makeVariable<double>(
+      Dims{Dim::X, Dim::Y}, Shape{2, 3}, units::m, Values{1, 2, 3, 4, 5, 6},
+      Variances{1, 2, 3, 4, 5, 6});
+  expect_matches_individual(var, Dim::X);
+  expect_matches_individual(var, Dim::Y);
+}
+
+TEST(ReduceManyTest, empty_dim) {
+  const auto var = makeVariable<double>(Dims{Dim::X, Dim::Y}, Shape{2, 0},
+                                        units::m, Values{}, Variances{});
+  expect_matches_individual(var, Dim::X);
+  expect_matches_individual(var, Dim::Y);
+}
+
+TEST(ReduceManyTest, large) {
+  for (const auto type : {dtype<double>, dtype<float>, dtype<int64_t>,
+                          dtype<int32_t>}) {
+    const auto var = make_large(type, false);
+    for (const auto dim : {Dim::X, Dim::Y, Dim::Z}) {
+      expect_matches_individual(var, dim);
+      expect_matches_individual(transpose(var), dim);
+    }
+  }
+}
+
+TEST(ReduceManyTest, large_with_variances) {
+  for (const auto type : {dtype<double>, dtype<float>}) {
+    const auto var = make_large(type, true);
+    for (const auto dim : {Dim::X, Dim::Y, Dim::Z})
+      expect_matches_individual(var, dim);
+  }
+}
+
+TEST(ReduceManyTest, independent_of_threads) {
+  std::mt19937 rng(1234);
+  std::uniform_real_distribution<double> dist(0.0, 1.0);
+  std::vector<double> values(200000);
+  for (auto &x : values)
+    x = dist(rng);
+  const auto var =
+      makeVariable<double>(Dims{Dim::X, Dim::Y}, Shape{100000, 2}, units::m,
+                           Values(values), Variances(values));
+  const auto mask = less(var, 0.1 * units::m);
+  const auto reduce = [&](const scipp::index threads) {
+    core::parallel::ThreadLimit limit(threads);
+    return std::pair{reduce_many(var, Dim::X, all_reductions),
+                     reduce_many(var, Dim::X, all_reductions, mask)};
+  };
+  const auto expected = reduce(1);
+  for (const scipp::index threads : {2, 3, 8})
+    EXPECT_EQ(reduce(threads), expected);
+}
+
+TEST(ReduceManyTest, bool_falls_back_to_individual_reductions) {
+  const auto var = makeVariable<bool>(Dims{Dim::X, Dim::Y}, Shape{2, 2},
+                                      Values{true, false, true, true});
+  const auto results =
+      reduce_many(var, Dim::X, {Reduction::Sum, Reduction::Max});
+  EXPECT_EQ(results[0], sum(var, Dim::X));
+  EXPECT_EQ(results[1], max(var, Dim::X));
+}
+
+TEST(ReduceManyTest, mask) {
+  auto var = make_large(dtype<double>, true);
+  const auto mask = less(var.slice({Dim::Y, 0}), 10.0 * units::m);
+  const auto results = reduce_many(var, Dim::Z, all_reductions, mask);
+  const auto masked = [&](const double fill) {
+    return where(mask, makeVariable<double>(units::m, Values{fill},
+                                            Variances{0.0}),
+                 var);
+  };
+  const auto counts = sum(~mask, Dim::Z);
+  auto denominator = astype(counts, dtype<double>);
+  denominator.setUnit(units::one);
+  EXPECT_EQ(results[0], sum(masked(0.0), Dim::Z));
+  EXPECT_EQ(results[1], sum(masked(0.0), Dim::Z) * reciprocal(denominator));
+  EXPECT_EQ(results[2],
+            min(masked(std::numeric_limits<double>::max()), Dim::Z));
+  EXPECT_EQ(results[3],
+            max(masked(std::numeric_limits<double>::lowest()), Dim::Z));
+  auto out_dims = var.dims();
+  out_dims.erase(Dim::Z);
+  EXPECT_EQ(results[4], copy(broadcast(counts, out_dims)));
+}
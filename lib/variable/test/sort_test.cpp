@@ -2,6 +2,11 @@
 // Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
 #include "scipp/variable/sort.h"
 #include "scipp/variable/util.h"
 #include "scipp/variable/variable.h"
@@ -44,3 +49,55 @@ TEST_F(SortTest, descending_with_variances) {
             makeVariable<double>(dims, Values{3.0, 2.0, 1.0, 5.0, 4.0, 0.0},
                                  Variances{2.0, 3.0, 1.0, 1.0, 3.0, 2.0}));
 }
+
+TEST_F(SortTest, nan) {
+  constexpr auto nan = std::numeric_limits<double>::quiet_NaN();
+  const auto x = makeVariable<double>(Dims{Dim::X}, Shape{4},
+                                      Values{2.0, nan, -1.0, 0.0});
+  const auto ascending = sort(x, Dim::X, SortOrder::Ascending);
+  EXPECT_EQ(ascending.slice({Dim::X, 0, 3}),
+            makeVariable<double>(Dims{Dim::X}, Shape{3},
+                                 Values{-1.0, 0.0, 2.0}));
+  EXPECT_TRUE(std::isnan(ascending.values<double>()[3]));
+  const auto descending = sort(x, Dim::X, SortOrder::Descending);
+  EXPECT_TRUE(std::isnan(descending.values<double>()[0]));
+  EXPECT_EQ(descending.slice({Dim::X, 1, 4}),
+            makeVariable<double>(Dims{Dim::X}, Shape{3},
+                                 Values{2.0, 0.0, -1.0}));
+}
+
+TEST_F(SortTest, large_with_variances) {
+  // Large enough for radix sort.
+  const scipp::index n = 1000;
+  std::vector<double> values(n);
+  std::vector<double> variances(n);
+  for (scipp::index i = 0; i < n; ++i) {
+    values[i] = static_cast<double>((i * 7919) % 1009) - 500.0;
+    variances[i] = 2.0 * values[i];
+  }
+  const auto x = makeVariable<double>(Dims{Dim::X}, Shape{n},
+                                      Values(values.begin(), values.end()),
+                                      Variances(variances.begin(),
+                                                variances.end()));
+  std::sort(values.begin(), values.end());
+  const auto sorted = sort(x, Dim::X, SortOrder::Ascending);
+  for (scipp::index i = 0; i < n; ++i) {
+    ASSERT_EQ(sorted.values<double>()[i], values[i]);
+    ASSERT_EQ(sorted.variances<double>()[i], 2.0 * values[i]);
+  }
+}
+
+TEST_F(SortTest, large_time_point_descending) {
+  const scipp::index n = 1000;
+  std::vector<core::time_point> values(n);
+  for (scipp::index i = 0; i < n; ++i)
+    values[i] = core::time_point{1600000000000000000 + (i * 7919) % 1009};
+  const auto x = makeVariable<core::time_point>(
+      Dims{Dim::X}, Shape{n}, units::ns, Values(values.begin(), values.end()));
+  std::sort(values.begin(), values.end(),
+            [](const auto &a, const auto &b) { return b < a; });
+  EXPECT_EQ(sort(x, Dim::X, SortOrder::Descending),
+            makeVariable<core::time_point>(
+                Dims{Dim::X}, Shape{n}, units::ns,
+                Values(values.begin(), values.end())));
+}
@@ -2,7 +2,14 @@
 // Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
 #include <gtest/gtest.h>
 
+#include <vector>
+
+#include "test_macros.h"
+
 #include "scipp/core/eigen.h"
+#include "scipp/core/except.h"
+#include "scipp/core/parallel.h"
+#include "scipp/variable/astype.h"
 #include "scipp/variable/reduction.h"
 #include "scipp/variable/shape.h"
 #include "scipp/variable/string.h"
@@ -69,3 +76,65 @@ TEST(SumPrecisionTest, sum_float) {
   EXPECT_EQ(nansum(var, Dim::X),
             makeVariable<float>(Values{init + (N / 2) * 1.0}));
 }
+
+namespace {
+Variable make_sum_input(const DType type) {
+  const Dimensions dims({Dim::Z, Dim::Y, Dim::X}, {5, 300, 70});
+  std::vector<double> values(dims.volume());
+  for (scipp::index i = 0; i < dims.volume(); ++i)
+    values[i] = 0.1 * static_cast<double>(i % 97) + 1e-3;
+  return astype(makeVariable<double>(dims, units::m, Values(values),
+                                     Variances(values)),
+                type);
+}
+} // namespace
+
+TEST(DeterministicSumTest, matches_default_for_exact_input) {
+  const auto var = makeVariable<float>(Dims{Dim::Y, Dim::X}, Shape{2, 3},
+                                       units::m, Values{1, 2, 3, 4, 5, 6},
+                                       Variances{1, 2, 3, 4, 5, 6});
+  for (const auto dim : {Dim::X, Dim::Y})
+    EXPECT_EQ(sum(var, dim, SumMode::Deterministic), sum(var, dim));
+  EXPECT_EQ(sum(var, SumMode::Deterministic), sum(var));
+  EXPECT_EQ(sum(var.slice({Dim::X, 0, 0}), Dim::X, SumMode::Deterministic),
+            sum(var.slice({Dim::X, 0, 0}), Dim::X));
+  EXPECT_EQ(sum(var.slice({Dim::X, 0, 0}), Dim::Y, SumMode::Deterministic),
+            sum(var.slice({Dim::X, 0, 0}), Dim::Y));
+}
+
+TEST(DeterministicSumTest, independent_of_threads_and_layout) {
+  for (const auto type : {dtype<double>, dtype<float>}) {
+    const auto var = make_sum_input(type);
+    for (const auto dim : {Dim::X, Dim::Y, Dim::Z}) {
+      const auto expected = [&]() {
+        core::parallel::ThreadLimit limit(1);
+        return sum(var, dim, SumMode::Deterministic);
+      }();
+      EXPECT_EQ(sum(var, dim, SumMode::Deterministic), expected);
+      EXPECT_EQ(sum(transpose(var), dim, SumMode::Deterministic),
+                transpose(expected));
+    }
+  }
+}
+
+TEST(DeterministicSumTest, precision) {
+  const scipp::index n = 10000000;
+  const auto var =
+      broadcast(makeVariable<double>(Values{0.1}), Dimensions(Dim::X, n));
+  const auto summed = sum(copy(var), Dim::X, SumMode::Deterministic);
+  EXPECT_NEAR(summed.value<double>(), 0.1 * n, 1e-8);
+}
+
+TEST(DeterministicSumTest, integers_are_exact) {
+  const auto var = makeVariable<int64_t>(Dims{Dim::X}, Shape{3},
+                                         Values{1, 2, 3});
+  EXPECT_EQ(sum(var, Dim::X, SumMode::Deterministic), sum(var, Dim::X));
+}
+
+TEST(DeterministicSumTest, unsupported_dtype_throws) {
+  const auto vector_var = makeVariable<Eigen::Vector3d>(
+      Dims{Dim::X}, Shape{2}, units::m,
+      Values{Eigen::Vector3d{1, 2, 3}, Eigen::Vector3d{4, 5, 6}});
+  EXPECT_THROW_DISCARD(sum(vector_var, Dim::X, SumMode::Deterministic),
+                       except::TypeError);
+}
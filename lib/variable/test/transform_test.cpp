@@ -130,6 +130,31 @@ TEST(TransformTest, user_op_with_variances) {
   EXPECT_EQ(result, var);
 }
 
+TEST(TransformTest, contiguous_int_output) {
+  // Writes to an int64 output could alias view parameters of the same type,
+  // make sure the contiguous inner loop yields correct results.
+  const auto a = makeVariable<int64_t>(Dims{Dim::X}, Shape{5},
+                                       Values{1, 2, 3, 4, 5});
+  const auto b = makeVariable<int32_t>(Dims{Dim::X}, Shape{5},
+                                       Values{10, 20, 30, 40, 50});
+  const auto result = transform<std::tuple<std::tuple<int64_t, int32_t>>>(
+      a, b, [](const auto x, const auto y) { return x * y; }, name);
+  EXPECT_EQ(result, makeVariable<int64_t>(Dims{Dim::X}, Shape{5},
+                                          Values{10, 40, 90, 160, 250}));
+}
+
+TEST(TransformTest, contiguous_in_place_overlapping_input) {
+  auto a = makeVariable<float>(Dims{Dim::X}, Shape{4},
+                               Values{1.0f, 2.0f, 3.0f, 4.0f});
+  // Overlapping input is copied before the operation is applied.
+  auto out = a.slice({Dim::X, 1, 4});
+  transform_in_place<pair_self_t<float>>(
+      out, a.slice({Dim::X, 0, 3}), [](auto &x, const auto &y) { x += y; },
+      name);
+  EXPECT_EQ(a, makeVariable<float>(Dims{Dim::X}, Shape{4},
+                                   Values{1.0f, 3.0f, 5.0f, 7.0f}));
+}
+
 class TransformInPlaceDryRunTest : public ::testing::Test {
 protected:
   static constexpr auto unary{[](auto &x) { x *= x; }};
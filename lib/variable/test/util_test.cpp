@@ -150,6 +150,29 @@ TEST(UtilTest, allsorted_multidimensional) {
   EXPECT_TRUE(allsorted(var, Dim::X, SortOrder::Descending));
 }
 
+TEST(UtilTest, edge_kind) {
+  EXPECT_EQ(edge_kind(makeVariable<double>(Dims{Dim::X}, Shape{3},
+                                           Values{1, 2, 3}),
+                      Dim::X),
+            variable::EdgeKind::Linspace);
+  EXPECT_EQ(edge_kind(makeVariable<double>(Dims{Dim::X}, Shape{3},
+                                           Values{1, 2, 4}),
+                      Dim::X),
+            variable::EdgeKind::Sorted);
+  EXPECT_EQ(edge_kind(makeVariable<double>(Dims{Dim::X}, Shape{3},
+                                           Values{1, 3, 2}),
+                      Dim::X),
+            variable::EdgeKind::Unsorted);
+}
+
+TEST(UtilTest, edge_kind_multidimensional) {
+  const auto var = makeVariable<double>(Dimensions{{Dim::Y, 2}, {Dim::X, 3}},
+                                        Values{1, 2, 3, 1, 2, 4});
+  EXPECT_EQ(edge_kind(var, Dim::X), variable::EdgeKind::Sorted);
+  EXPECT_EQ(edge_kind(var.slice({Dim::Y, 0}), Dim::X),
+            variable::EdgeKind::Linspace);
+}
+
 TEST(VariableTest, where) {
   auto var =
       makeVariable<double>(Dims{Dim::X}, Shape{3}, units::m, Values{1, 2, 3});
@@ -78,6 +78,18 @@ bool allsorted(const Variable &x, const Dim dim, const SortOrder order) {
   return variable::all(issorted(x, dim, order)).value<bool>();
 }
 
+/// Return the kind of the bin edges along given dim.
+///
+/// Edges are EdgeKind::Linspace if all slices along `dim` are linearly spaced
+/// and ascending, else EdgeKind::Sorted if all are sorted in ascending order.
+/// Operations should call this once and then select a kernel specialized for
+/// the edge kind, instead of inspecting the edges for every output element.
+EdgeKind edge_kind(const Variable &edges, const Dim dim) {
+  if (variable::all(islinspace(edges, dim)).value<bool>())
+    return EdgeKind::Linspace;
+  return allsorted(edges, dim) ? EdgeKind::Sorted : EdgeKind::Unsorted;
+}
+
 /// Zip elements of two variables into a variable where each element is a pair.
 Variable zip(const Variable &first, const Variable &second) {
   return transform(first, second, core::element::zip, "zip");
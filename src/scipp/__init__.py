@@ -72,7 +72,7 @@ from .core import groupby
 from .core import logical_not, logical_and, logical_or, logical_xor
 from .core import abs, nan_to_num, norm, reciprocal, pow, sqrt, exp, log, log10, round, floor, ceil, erf, erfc, midpoints
 from .core import dot, islinspace, issorted, allsorted, cross, sort, values, variances, stddevs, where
-from .core import mean, nanmean, sum, nansum, min, max, nanmin, nanmax, all, any
+from .core import mean, nanmean, sum, nansum, min, max, nanmin, nanmax, all, any, reduce_many
 from .core import broadcast, concat, fold, flatten, squeeze, transpose
 from .core import sin, cos, tan, asin, acos, atan, atan2
 from .core import isnan, isinf, isfinite, isposinf, isneginf, to_unit
@@ -84,7 +84,7 @@ from .logging import display_logs, get_logger
 from .reduction import reduce
 
 # Mainly imported for docs
-from .core import Bins, Coords, GroupByDataset, GroupByDataArray, Masks
+from .core import BinPlan, Bins, Coords, GroupByDataset, GroupByDataArray, Masks
 
 from . import _binding
 
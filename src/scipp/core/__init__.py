@@ -11,8 +11,8 @@ if _debug_:
     )
 
 from .._scipp import __version__
-from .cpp_classes import Coords, DataArray, Dataset, DType, GroupByDataArray,\
-                         GroupByDataset, Masks, Unit, Variable
+from .cpp_classes import BinPlan, Coords, DataArray, Dataset, DType, \
+                         GroupByDataArray, GroupByDataset, Masks, Unit, Variable
 # Import errors
 from .cpp_classes import BinEdgeError, BinnedDataError, CoordError, \
                          DataArrayError, DatasetError, DimensionError, \
@@ -69,7 +69,7 @@ from .groupby import groupby
 from .logical import logical_not, logical_and, logical_or, logical_xor
 from .math import abs, cross, dot, nan_to_num, norm, reciprocal, pow, sqrt, exp, log, log10, round, floor, ceil, erf, erfc, midpoints
 from .operations import islinspace, issorted, allsorted, sort, values, variances, stddevs, where, to
-from .reduction import mean, nanmean, sum, nansum, min, max, nanmin, nanmax, all, any
+from .reduction import mean, nanmean, sum, nansum, min, max, nanmin, nanmax, all, any, reduce_many
 from .shape import broadcast, concat, fold, flatten, squeeze, transpose
 from .trigonometry import sin, cos, tan, asin, acos, atan, atan2
 from .unary import isnan, isinf, isfinite, isposinf, isneginf, to_unit
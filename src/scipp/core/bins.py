@@ -1,7 +1,7 @@
 # SPDX-License-Identifier: BSD-3-Clause
 # Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
 # @author Simon Heybrock
-from typing import Callable, Dict, Literal, Optional, Union
+from typing import Callable, Dict, Literal, Optional, Tuple, Union
 import uuid
 
 from .._scipp import core as _cpp
@@ -132,6 +132,24 @@ class Bins:
         _cpp.buckets.scale(self._obj, _cpp.reciprocal(lut.func), lut.dim)
         return self
 
+    def __getitem__(self, key: Tuple[str, slice]):
+        """Select the bin contents in a range of values of a coordinate.
+
+        The syntax is ``var.bins[name, start:stop]``, selecting the elements of
+        every bin with ``start <= coord < stop``, where ``coord`` is the
+        coordinate ``name`` of the bin contents. ``start`` and ``stop`` must be
+        scalar variables or ``None``. The result is a copy. If the bins are
+        sorted by ``name``, see :py:meth:`sort`, the bin ranges are found by
+        binary search and only the selected elements are copied. Otherwise all
+        elements are scanned. See :py:meth:`slice_view` for slicing without copy.
+        """
+        dim, index = key
+        if not isinstance(index, slice) or index.step is not None:
+            raise ValueError("Bins can only be sliced by value with a range "
+                             f"without step, e.g., bins['x', start:stop], got {key}")
+        return _call_cpp_func(_cpp.buckets.slice, self._obj, dim, index.start,
+                              index.stop)
+
     @property
     def coords(self) -> MetaDataMap:
         """Coords of the bins"""
@@ -396,6 +414,83 @@ class Bins:
                 out = _call_cpp_func(_cpp.buckets.concatenate, self._obj, other)
             return out
 
+    def compact(self) -> None:
+        """Remove unused capacity from the buffer holding the bin contents, in-place.
+
+        Concatenating with ``out`` set to the input reserves extra capacity in
+        every bin, such that repeatedly appending small batches of events is fast.
+        This restores a buffer without gaps between bins.
+        """
+        _cpp.buckets.compact(self._obj)
+
+    def sort(self, key: str) -> Union[_cpp.Variable, _cpp.DataArray]:
+        """Sort the contents of every bin by a coordinate of the bin contents.
+
+        Bins are sorted stably in ascending order, NaNs are placed last. All
+        columns of the bin contents are reordered accordingly. The result is
+        marked as sorted by ``key``, which operations such as slicing bins by
+        value can use to avoid scanning the bin contents. To keep the order
+        intact, the coordinate ``key`` of the result is read-only.
+
+        Parameters
+        ----------
+        key:
+            Name of the coordinate of the bin contents to sort by.
+
+        Returns
+        -------
+        :
+            Copy of the input with the contents of every bin sorted.
+        """
+        return _call_cpp_func(_cpp.buckets.sort, self._obj, key)
+
+    @property
+    def sorted_by(self) -> Optional[str]:
+        """Name of the coordinate the bin contents are sorted by.
+
+        This is set by :py:meth:`sort` and is ``None`` otherwise. The sorted
+        coordinate is read-only, so it cannot be modified in place. Replacing
+        or removing it, e.g., via ``x.bins.coords['t'] = -t``, resets this to
+        ``None``, and so do deep copies.
+        """
+        return _cpp.buckets.sorted_by(self._data())
+
+    def slice_view(
+            self,
+            name: str,
+            start: Optional[_cpp.Variable] = None,
+            stop: Optional[_cpp.Variable] = None
+    ) -> Union[_cpp.Variable, _cpp.DataArray]:
+        """Select the bin contents in a range of values of a coordinate, without
+        copy.
+
+        This is equivalent to ``var.bins[name, start:stop]``, but the result
+        is a view that shares the bin contents with the input, i.e., modifying
+        the bin contents of the result modifies the input. The bins must be
+        sorted by ``name``, see :py:meth:`sort`.
+
+        Parameters
+        ----------
+        name:
+            Name of the coordinate of the bin contents to slice by.
+        start:
+            Scalar lower bound (inclusive), or ``None`` for no lower bound.
+        stop:
+            Scalar upper bound (exclusive), or ``None`` for no upper bound.
+
+        Returns
+        -------
+        :
+            View of the input with the contents of every bin restricted to the
+            selected elements.
+
+        Raises
+        ------
+        scipp.BinnedDataError
+            If the bins are not sorted by ``name``.
+        """
+        return _call_cpp_func(_cpp.buckets.slice_view, self._obj, name, start, stop)
+
 
 class GroupbyBins:
     """Proxy for operations on bins of a groupby object."""
@@ -3,8 +3,8 @@
 
 # flake8: noqa: F401
 
-from .._scipp.core import Coords, DataArray, Dataset, DType, GroupByDataArray, \
-    GroupByDataset, Masks, Unit, Variable
+from .._scipp.core import BinPlan, Coords, DataArray, Dataset, DType, \
+    GroupByDataArray, GroupByDataset, Masks, Unit, Variable
 
 from .._scipp.core import BinEdgeError, BinnedDataError, CoordError, \
     DataArrayError, DatasetError, DimensionError, \
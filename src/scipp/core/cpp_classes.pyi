@@ -1536,6 +1536,11 @@ class Variable():
            Type of the variable's elements. Is deduced from other arguments
            in most cases. Defaults to ``sc.DType.float64`` if no deduction is
            possible.
+        copy:
+           If ``False``, ``values`` and ``variances`` that are C-contiguous, aligned,
+           and writeable numpy arrays of exactly the requested dtype are used without
+           copying. The variable then shares memory with the arrays.
+           Other inputs are always copied.
         """
     def __invert__(self) -> Variable: ...
     def __ior__(self, arg0: Variable) -> object: ...
@@ -3,7 +3,7 @@
 # @author Simon Heybrock
 
 from __future__ import annotations
-from typing import Optional
+from typing import Dict, Literal, Optional, Sequence
 
 from .._scipp import core as _cpp
 from ..typing import VariableLikeType
@@ -81,7 +81,10 @@ def nanmean(x: VariableLikeType, dim: Optional[str] = None) -> VariableLikeType:
         return _cpp.nanmean(x, dim=dim)
 
 
-def sum(x: VariableLikeType, dim: Optional[str] = None) -> VariableLikeType:
+def sum(x: VariableLikeType,
+        dim: Optional[str] = None,
+        *,
+        mode: Literal['default', 'deterministic'] = 'default') -> VariableLikeType:
     """Sum of elements in the input.
 
     If the input data is in single precision (dtype='float32') this internally uses
@@ -90,6 +93,12 @@ def sum(x: VariableLikeType, dim: Optional[str] = None) -> VariableLikeType:
     to float32 after handling each dimension, i.e., the result is equivalent to what
     would be obtained from manually summing individual dimensions.
 
+    By default the order in which floating-point elements are added depends on the
+    number of threads, so results may differ in the last bits between runs on
+    different machines. With ``mode='deterministic'`` elements are summed pairwise in
+    blocks of fixed size, which gives bitwise reproducible results regardless of the
+    number of threads and reduces rounding errors for long dimensions.
+
     Parameters
     ----------
     x: scipp.typing.VariableLike
@@ -97,6 +106,10 @@ def sum(x: VariableLikeType, dim: Optional[str] = None) -> VariableLikeType:
     dim:
         Optional dimension along which to calculate the sum. If not
         given, the sum over all dimensions is calculated.
+    mode:
+        Summation algorithm, 'default' or 'deterministic'. 'deterministic' is
+        supported for variables and data arrays with dense integer, bool, or
+        floating-point data.
 
     Returns
     -------
@@ -108,6 +121,10 @@ def sum(x: VariableLikeType, dim: Optional[str] = None) -> VariableLikeType:
     scipp.nansum:
         Ignore NaN's when calculating the sum.
     """
+    if mode != 'default':
+        if dim is None:
+            return _cpp.sum(x, mode=mode)
+        return _cpp.sum(x, dim=dim, mode=mode)
     if dim is None:
         return _cpp.sum(x)
     else:
@@ -321,3 +338,40 @@ def any(x: VariableLikeType, dim: Optional[str] = None) -> VariableLikeType:
         return _cpp.any(x)
     else:
         return _cpp.any(x, dim=dim)
+
+
+def reduce_many(
+    x: VariableLikeType,
+    dim: str,
+    reductions: Sequence[str] = ('sum', 'mean', 'min', 'max', 'count')
+) -> Dict[str, VariableLikeType]:
+    """Compute several reductions along a dimension in a single pass.
+
+    This is equivalent to calling :py:func:`scipp.sum`, :py:func:`scipp.mean`,
+    :py:func:`scipp.min`, and :py:func:`scipp.max` individually, but the input is
+    traversed only once. This is considerably faster for large inputs if more than
+    one reduction is required.
+
+    Parameters
+    ----------
+    x: scipp.Variable | scipp.DataArray
+        Input data.
+    dim:
+        Dimension along which to reduce.
+    reductions:
+        Names of the reductions to compute, any of 'sum', 'mean', 'min', 'max',
+        and 'count'. 'count' is the number of elements (or unmasked elements, or
+        events in the case of binned data) that contributed to the reduction.
+
+    Returns
+    -------
+    :
+        Dict mapping the names in ``reductions`` to the results.
+
+    See Also
+    --------
+    scipp.sum, scipp.mean, scipp.min, scipp.max
+    """
+    reductions = list(reductions)
+    results = _cpp.reduce_many(x, dim=dim, reductions=reductions)
+    return dict(zip(reductions, results))
@@ -469,7 +469,8 @@ def array(*,
           values: ArrayLike,
           variances: Optional[ArrayLike] = None,
           unit: Union[Unit, str, None] = default_unit,
-          dtype: Optional[DTypeLike] = None) -> Variable:
+          dtype: Optional[DTypeLike] = None,
+          copy: bool = True) -> Variable:
     """Constructs a :class:`Variable` with given dimensions, containing given
     values and optional variances.
 
@@ -488,6 +489,11 @@ def array(*,
         Unit of contents.
     dtype: scipp.typing.DTypeLike
         Type of underlying data. By default, inferred from `values` argument.
+    copy:
+        If ``False``, avoid copying numpy arrays given as `values` and
+        `variances` if they are C-contiguous, aligned, writeable, and of
+        exactly the requested dtype. The variable then shares memory with
+        the arrays. Other inputs are always copied.
 
     Returns
     -------
@@ -533,7 +539,8 @@ def array(*,
                          values=values,
                          variances=variances,
                          unit=unit,
-                         dtype=dtype)
+                         dtype=dtype,
+                         copy=copy)
 
 
 def _expect_no_variances(args):
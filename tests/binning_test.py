@@ -547,3 +547,21 @@ def test_variable_bin_equivalent_to_bin_of_data_array_with_counts():
     coord = sc.array(dims=['row'], values=[2, 2, 1, 3])
     da = sc.DataArray(data, coords={'x': coord})
     assert sc.identical(coord.bin(x=3), da.bin(x=3))
+
+
+def test_bin_plan_apply_equivalent_to_bin():
+    rng = default_rng(seed=1234)
+    x_edges = sc.linspace('x', 0.0, 1.0, num=5, unit='m')
+    groups = sc.array(dims=['label'], values=[0, 1, 2])
+    plan = sc.BinPlan(edges=[x_edges], groups=[groups])
+    for size in [0, 10, 1000]:
+        table = sc.data.table_xyz(size)
+        table.coords['x'] = sc.array(dims=['row'],
+                                     values=rng.random(size),
+                                     unit='m')
+        table.coords['label'] = sc.array(dims=['row'],
+                                         values=rng.integers(0, 4, size))
+        expected = sc.binning.make_binned(table, edges=[x_edges], groups=[groups])
+        assert sc.identical(plan.apply(table), expected)
+        target_bins = plan.target_bins(table)
+        assert sc.identical(plan.apply(table, target_bins=target_bins), expected)
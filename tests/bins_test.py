@@ -395,3 +395,89 @@ def test_bins_concat():
     assert sc.identical(da.bins.concat('x').hist(), table.hist(y=5))
     assert sc.identical(da.bins.concat('y').hist(), table.hist(x=4))
     assert sc.identical(da.bins.concat().hist(), table.sum())
+
+
+def test_bins_concatenate_out_then_compact():
+    table = sc.data.table_xyz(nrow=100)
+    da = table.bin(x=4)
+    expected = da.copy()
+    for batch in [table['row', :10], table['row', 10:15], table['row', 15:]]:
+        batch = batch.bin(x=da.coords['x'])
+        expected = expected.bins.concatenate(batch)
+        da.bins.concatenate(batch, out=da)
+        assert sc.identical(da, expected)
+    da.bins.compact()
+    assert sc.identical(da, expected)
+    assert da.bins.constituents['data'].sizes == {'row': 200}
+
+
+def test_bins_sort():
+    table = sc.data.table_xyz(nrow=1000)
+    da = table.bin(x=4)
+    assert da.bins.sorted_by is None
+    result = da.bins.sort('y')
+    assert result.bins.sorted_by == 'y'
+    for i in range(4):
+        expected = sc.sort(da['x', i].values, 'y')
+        assert sc.identical(result['x', i].values, expected)
+    assert sc.identical(result.bins.concat().hist(), da.bins.concat().hist())
+
+
+def test_bins_sort_marker_reset_by_append():
+    table = sc.data.table_xyz(nrow=100)
+    da = table.bin(x=4).bins.sort('y')
+    da.bins.concatenate(table.bin(x=da.coords['x']), out=da)
+    assert da.bins.sorted_by is None
+
+
+def test_bins_sort_key_is_readonly():
+    table = sc.data.table_xyz(nrow=100)
+    da = table.bin(x=4).bins.sort('y')
+    with pytest.raises(sc.VariableError):
+        da.bins.coords['y'] *= -1.0
+    assert da.bins.sorted_by == 'y'
+    da.bins.coords['y'] = -da.bins.coords['y']
+    assert da.bins.sorted_by is None
+
+
+def test_bins_slice_by_value():
+    table = sc.data.table_xyz(nrow=1000)
+    da = table.bin(x=4)
+    unit = da.bins.coords['y'].bins.unit
+    start = sc.scalar(0.2, unit=unit)
+    stop = sc.scalar(0.6, unit=unit)
+    result = da.bins['y', start:stop]
+    sorted_result = da.bins.sort('y').bins['y', start:stop]
+    assert result.bins.sorted_by is None
+    assert sorted_result.bins.sorted_by == 'y'
+    for i in range(4):
+        y = da['x', i].values.coords['y'].values
+        selected = y[(y >= 0.2) & (y < 0.6)]
+        np.testing.assert_array_equal(result['x', i].values.coords['y'].values,
+                                      selected)
+        np.testing.assert_array_equal(
+            sorted_result['x', i].values.coords['y'].values, np.sort(selected))
+    assert sc.identical(da.bins['y', :stop], da.bins['y', None:stop])
+    assert sc.identical(da.bins['y', :], da)
+
+
+def test_bins_slice_by_value_requires_range():
+    da = sc.data.table_xyz(nrow=10).bin(x=2)
+    with pytest.raises(ValueError):
+        da.bins['y', sc.scalar(0.5, unit='m')]
+    with pytest.raises(ValueError):
+        da.bins['y', ::2]
+
+
+def test_bins_slice_view():
+    table = sc.data.table_xyz(nrow=100)
+    da = table.bin(x=4)
+    stop = sc.scalar(0.5, unit=da.bins.coords['y'].bins.unit)
+    with pytest.raises(sc.BinnedDataError):
+        da.bins.slice_view('y', stop=stop)
+    da = da.bins.sort('y')
+    view = da.bins.slice_view('y', stop=stop)
+    assert sc.identical(view, da.bins['y', :stop])
+    view.bins.data *= 0.0
+    summed = da.bins['y', :stop].bins.sum()
+    assert sc.identical(summed, sc.zeros_like(summed))
@@ -0,0 +1,25 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+import scipp as sc
+from scipp._scipp import core as _cpp
+
+
+def test_memory_pool_stats_reports_reuse():
+    before = _cpp.memory_pool_stats()
+    for _ in range(3):
+        sc.zeros(dims=['x'], shape=[100000])
+    after = _cpp.memory_pool_stats()
+    assert set(after) == {'bytes_live', 'bytes_cached', 'hits', 'misses', 'hit_rate'}
+    assert after['hits'] > before['hits']
+    assert 0.0 <= after['hit_rate'] <= 1.0
+
+
+def test_memory_pool_limit():
+    limit = _cpp.get_memory_pool_limit()
+    try:
+        _cpp.set_memory_pool_limit(0)
+        sc.zeros(dims=['x'], shape=[100000])
+        assert _cpp.get_memory_pool_limit() == 0
+        assert _cpp.memory_pool_stats()['bytes_cached'] == 0
+    finally:
+        _cpp.set_memory_pool_limit(limit)
@@ -85,3 +85,65 @@ def test__array_ufunc___disabled(obj):
     with pytest.raises(TypeError, match="does not support ufuncs"):
         b = np.arange(2)
         b += obj
+
+
+def test_array_copy_false_shares_memory():
+    values = np.arange(4.0)
+    var = sc.array(dims=['x'], values=values, copy=False)
+    values[0] = 10.0
+    assert var.values[0] == 10.0
+    var.values[1] = 20.0
+    assert values[1] == 20.0
+
+
+def test_array_copy_false_shares_variances():
+    values = np.arange(4.0)
+    variances = np.arange(4.0)
+    var = sc.array(dims=['x'], values=values, variances=variances, copy=False)
+    variances[0] = 10.0
+    assert var.variances[0] == 10.0
+
+
+def test_array_copy_false_keeps_buffer_alive():
+    var = sc.array(dims=['x'], values=np.arange(4.0), copy=False)
+    assert sc.identical(var, sc.array(dims=['x'], values=[0.0, 1.0, 2.0, 3.0]))
+
+
+def test_array_copy_false_copy_of_variable_does_not_share_memory():
+    values = np.arange(4.0)
+    var = sc.array(dims=['x'], values=values, copy=False).copy()
+    values[0] = 10.0
+    assert var.values[0] == 0.0
+
+
+@pytest.mark.parametrize(
+    "values", [np.arange(8.0)[::2],
+               np.arange(4), np.arange(4.0).astype('>f8')])
+def test_array_copy_false_copies_if_layout_or_dtype_differs(values):
+    var = sc.array(dims=['x'], values=values, dtype='float64', copy=False)
+    values[0] = 10
+    assert var.values[0] == 0.0
+
+
+def test_array_copy_false_copies_readonly():
+    values = np.arange(4.0)
+    values.flags.writeable = False
+    var = sc.array(dims=['x'], values=values, copy=False)
+    var.values[0] = 10.0
+    assert values[0] == 0.0
+
+
+def test_array_copy_is_default():
+    values = np.arange(4.0)
+    var = sc.array(dims=['x'], values=values)
+    values[0] = 10.0
+    assert var.values[0] == 0.0
+
+
+def test_array_more_than_4_dims():
+    values = np.arange(64.0).reshape(2, 2, 2, 2, 4)
+    var = sc.array(dims=['a', 'b', 'c', 'd', 'e'], values=values)
+    np.testing.assert_array_equal(var.values, values)
+    np.testing.assert_array_equal(
+        sc.array(dims=['a', 'b', 'c', 'd', 'e'],
+                 values=values[..., ::2]).values, values[..., ::2])
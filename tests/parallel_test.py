@@ -0,0 +1,30 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+import pytest
+
+import scipp as sc
+from scipp._scipp import core as _cpp
+
+
+def test_thread_limit_restores_previous_limit():
+    before = _cpp.get_max_threads()
+    with _cpp.thread_limit(1):
+        assert _cpp.get_max_threads() == 1
+        var = sc.arange('x', 1000000.0)
+        assert sc.identical(var + var, 2.0 * var)
+    assert _cpp.get_max_threads() == before
+
+
+def test_thread_limit_rejects_zero():
+    with pytest.raises(ValueError):
+        with _cpp.thread_limit(0):
+            pass
+
+
+def test_set_max_threads():
+    try:
+        _cpp.set_max_threads(1)
+        assert _cpp.get_max_threads() == 1
+    finally:
+        _cpp.set_max_threads(0)
+    assert _cpp.get_max_threads() >= 1
@@ -3,7 +3,9 @@
 # @file
 # @author Simon Heybrock
 import scipp as sc
+from scipp._scipp import core as _cpp
 import numpy as np
+import pytest
 
 
 def test_all():
@@ -54,6 +56,25 @@ def test_sum():
     assert sc.identical(sc.sum(var, 'x'), sc.array(dims=['y'], values=[2.0, 4.0]))
 
 
+def test_sum_deterministic():
+    var = sc.arange('r', 6.0, unit='m').fold('r', sizes={'x': 2, 'y': 3})
+    assert sc.identical(sc.sum(var, mode='deterministic'), sc.sum(var))
+    assert sc.identical(sc.sum(var, 'x', mode='deterministic'), sc.sum(var, 'x'))
+    assert sc.identical(var.sum('y', mode='deterministic'), var.sum('y'))
+
+
+def test_sum_deterministic_independent_of_threads():
+    var = sc.array(dims=['x'], values=np.random.default_rng(1234).random(100000))
+    with _cpp.thread_limit(1):
+        expected = sc.sum(var, 'x', mode='deterministic')
+    assert sc.identical(sc.sum(var, 'x', mode='deterministic'), expected)
+
+
+def test_sum_bad_mode():
+    with pytest.raises(ValueError):
+        sc.sum(sc.arange('x', 4.0), 'x', mode='fast')
+
+
 def test_nansum():
     var = sc.array(dims=['x', 'y'], values=[[1.0, 1.0], [1.0, np.nan]])
     assert sc.identical(sc.nansum(var), sc.scalar(3.0))
@@ -70,3 +91,42 @@ def test_nanmean():
     var = sc.array(dims=['x', 'y'], values=[[1.0, 1.0], [1.0, 1.0]])
     assert sc.identical(sc.nanmean(var), sc.scalar(3.0 / 3))
     assert sc.identical(sc.nanmean(var, 'x'), sc.array(dims=['y'], values=[1.0, 1.0]))
+
+
+def test_reduce_many():
+    var = sc.arange('r', 6.0, unit='m').fold('r', sizes={'x': 2, 'y': 3})
+    results = sc.reduce_many(var, 'x')
+    assert list(results) == ['sum', 'mean', 'min', 'max', 'count']
+    assert sc.identical(results['sum'], sc.sum(var, 'x'))
+    assert sc.identical(results['mean'], sc.mean(var, 'x'))
+    assert sc.identical(results['min'], sc.min(var, 'x'))
+    assert sc.identical(results['max'], sc.max(var, 'x'))
+    assert sc.identical(results['count'],
+                        sc.array(dims=['y'], values=[2, 2, 2], unit=None))
+
+
+def test_reduce_many_subset():
+    var = sc.arange('r', 6.0, unit='m').fold('r', sizes={'x': 2, 'y': 3})
+    results = sc.reduce_many(var, 'y', reductions=['max', 'sum'])
+    assert list(results) == ['max', 'sum']
+    assert sc.identical(results['max'], sc.max(var, 'y'))
+    assert sc.identical(results['sum'], sc.sum(var, 'y'))
+
+
+def test_reduce_many_bad_reduction():
+    var = sc.arange('x', 6.0)
+    with pytest.raises(ValueError):
+        sc.reduce_many(var, 'x', reductions=['median'])
+
+
+def test_reduce_many_data_array_with_mask():
+    da = sc.DataArray(sc.arange('r', 6.0, unit='m').fold('r', sizes={'x': 2, 'y': 3}),
+                      coords={'y': sc.arange('y', 3)},
+                      masks={'m': sc.array(dims=['y'], values=[False, True, False])})
+    results = sc.reduce_many(da, 'y')
+    assert sc.identical(results['sum'], sc.sum(da, 'y'))
+    assert sc.identical(results['mean'], sc.mean(da, 'y'))
+    assert sc.identical(results['min'], sc.min(da, 'y'))
+    assert sc.identical(results['max'], sc.max(da, 'y'))
+    assert sc.identical(results['count'].data,
+                        sc.array(dims=['x'], values=[2, 2], unit=None))